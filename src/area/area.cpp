@@ -15,6 +15,7 @@
 #include "../geometry/units.h"
 #include "../geometry/point.h"
 #include "../geometry/polygon.h"
+#include "../geometry/orientedbox.h"
 #include "../geometry/vector.h"
 
 Area::Area()
@@ -28,18 +29,24 @@ Area::Area(Area const& source)
 
   *constraints = *(source.constraints);
   parentArea = source.parentArea;
+  *boundingRectangle = *(source.boundingRectangle);
+  boundingRectangleIsValid = source.boundingRectangleIsValid;
 }
 
 void Area::initialize()
 {
   parentArea = 0;
   constraints = new Polygon();
+  boundingRectangle = new OrientedBox();
+  boundingRectangleIsValid = false;
 }
 
 Area& Area::operator=(Area const& source)
 {
   *constraints = *(source.constraints);
   parentArea = source.parentArea;
+  *boundingRectangle = *(source.boundingRectangle);
+  boundingRectangleIsValid = source.boundingRectangleIsValid;
 
   return *this;
 }
@@ -52,6 +59,7 @@ Area::~Area()
 void Area::freeMemory()
 {
   delete constraints;
+  delete boundingRectangle;
 }
 
 Polygon Area::areaConstraints()
@@ -62,6 +70,7 @@ Polygon Area::areaConstraints()
 void Area::setAreaConstraints(Polygon const& area)
 {
   *constraints = area;
+  boundingRectangleIsValid = false;
 }
 
 void  Area::setParent(Area* area)
@@ -72,4 +81,15 @@ void  Area::setParent(Area* area)
 Area* Area::parent()
 {
   return parentArea;
-}
\ No newline at end of file
+}
+
+OrientedBox Area::orientedBox()
+{
+  if (!boundingRectangleIsValid)
+  {
+    *boundingRectangle = OrientedBox(*constraints);
+    boundingRectangleIsValid = true;
+  }
+
+  return *boundingRectangle;
+}
@@ -18,6 +18,7 @@
 #include <map>
 
 class Polygon;
+class OrientedBox;
 class StreetGraph;
 class RoadLSystem;
 class Intersection;
@@ -45,10 +46,22 @@ class Area
     virtual void setParent(Area* area);
     virtual Area* parent();
 
+    /**
+      Minimal area rectangle around the area.
+     @remarks
+       Computed on the first call after the constraints were set.
+       Its axis follows the longer side of the area.
+     */
+    OrientedBox orientedBox();
+
   protected:
     Polygon* constraints;
     Area* parentArea;
 
+    /** Cached result of orientedBox(). */
+    OrientedBox* boundingRectangle;
+    bool boundingRectangleIsValid;
+
   private:
     void initialize();
     void freeMemory();
@@ -366,3 +366,12 @@ std::list<Lot*> Block::getLots()
 {
   return lots;
 }
+
+void Block::exportLots(std::vector<FloatPolygon>* borders)
+{
+  borders->reserve(borders->size() + lots.size());
+  for (std::list<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+  {
+    borders->push_back(FloatPolygon((*lot)->areaConstraints()));
+  }
+}
@@ -14,9 +14,11 @@
 
 /* STL */
 #include <string>
+#include <vector>
 
 /* libcity */
 #include "area.h"
+#include "../geometry/compactpolygon.h"
 
 class LineSegment;
 class Point;
@@ -55,6 +57,12 @@ class Block : public Area
     void createLots(double lotWidth, double lotHeight, double deviance);
     std::list<Lot*> getLots();
 
+    /**
+      Store borders of all the lots in compact form.
+     @param[out] borders Borders of lots are appended to this vector.
+     */
+    void exportLots(std::vector<FloatPolygon>* borders);
+
   private:
 
     Point calcSplitPoint(LineSegment const& longestEdge, double splitSize, double lotDeviance);
@@ -29,7 +29,6 @@ void Zone::initialize()
 {
   associatedStreetGraph = 0;
   roadGenerator = 0;
-  constraints = new Polygon();
   blocks = new std::list<Block*>;
 }
 
@@ -41,7 +40,6 @@ Zone::~Zone()
 void Zone::freeMemory()
 {
   freeRoadGenerator();
-  delete constraints;
   delete blocks;
 }
 
@@ -65,6 +63,7 @@ Zone& Zone::operator=(Zone const& source)
 {
   associatedStreetGraph = source.associatedStreetGraph;
   *constraints = *(source.constraints);
+  boundingRectangleIsValid = false;
 
   roadGenerator = source.roadGenerator;
 
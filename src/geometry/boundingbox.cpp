@@ -0,0 +1,102 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/boundingbox.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see geometry/boundingbox.h
+ *
+ */
+
+#include "boundingbox.h"
+#include "point.h"
+
+#include <sstream>
+#include <string>
+
+BoundingBox::BoundingBox()
+  : minXCoordinate(1), minYCoordinate(1), maxXCoordinate(-1), maxYCoordinate(-1)
+{}
+
+BoundingBox::BoundingBox(Point const& first, Point const& second)
+  : minXCoordinate(1), minYCoordinate(1), maxXCoordinate(-1), maxYCoordinate(-1)
+{
+  include(first);
+  include(second);
+}
+
+void BoundingBox::include(Point const& point)
+{
+  if (isEmpty())
+  {
+    minXCoordinate = maxXCoordinate = point.x();
+    minYCoordinate = maxYCoordinate = point.y();
+    return;
+  }
+
+  if (point.x() < minXCoordinate) minXCoordinate = point.x();
+  if (point.x() > maxXCoordinate) maxXCoordinate = point.x();
+  if (point.y() < minYCoordinate) minYCoordinate = point.y();
+  if (point.y() > maxYCoordinate) maxYCoordinate = point.y();
+}
+
+void BoundingBox::include(BoundingBox const& box)
+{
+  if (box.isEmpty())
+  {
+    return;
+  }
+
+  include(Point(box.minX(), box.minY()));
+  include(Point(box.maxX(), box.maxY()));
+}
+
+void BoundingBox::expand(double distance)
+{
+  if (isEmpty())
+  {
+    return;
+  }
+
+  minXCoordinate -= distance;
+  minYCoordinate -= distance;
+  maxXCoordinate += distance;
+  maxYCoordinate += distance;
+}
+
+bool BoundingBox::contains(Point const& point) const
+{
+  return point.x() >= minXCoordinate && point.x() <= maxXCoordinate &&
+         point.y() >= minYCoordinate && point.y() <= maxYCoordinate;
+}
+
+bool BoundingBox::contains(BoundingBox const& box) const
+{
+  if (isEmpty() || box.isEmpty())
+  {
+    return false;
+  }
+
+  return box.minX() >= minXCoordinate && box.maxX() <= maxXCoordinate &&
+         box.minY() >= minYCoordinate && box.maxY() <= maxYCoordinate;
+}
+
+bool BoundingBox::intersects(BoundingBox const& box) const
+{
+  if (isEmpty() || box.isEmpty())
+  {
+    return false;
+  }
+
+  return box.minX() <= maxXCoordinate && box.maxX() >= minXCoordinate &&
+         box.minY() <= maxYCoordinate && box.maxY() >= minYCoordinate;
+}
+
+std::string BoundingBox::toString() const
+{
+  std::stringstream convertor;
+  convertor << "BoundingBox(" << minXCoordinate << ", " << minYCoordinate << ", "
+                              << maxXCoordinate << ", " << maxYCoordinate << ")";
+  return convertor.str();
+}
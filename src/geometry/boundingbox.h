@@ -0,0 +1,90 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/boundingbox.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Axis aligned bounding box in the XY plane.
+ *
+ */
+
+#ifndef _BOUNDINGBOX_H_
+#define _BOUNDINGBOX_H_
+
+#include <string>
+
+class Point;
+
+class BoundingBox
+{
+  public:
+    BoundingBox(); /**< Empty box */
+    BoundingBox(Point const& first, Point const& second); /**< Box around two points */
+
+    /** Box containing no points at all. */
+    bool isEmpty() const;
+
+    double minX() const;
+    double minY() const;
+    double maxX() const;
+    double maxY() const;
+
+    /**
+      Grow the box so it contains the point.
+     @param[in] point Point to be included.
+     */
+    void include(Point const& point);
+
+    /**
+      Grow the box so it contains another box.
+     @param[in] box Box to be included.
+     */
+    void include(BoundingBox const& box);
+
+    /**
+      Push all the borders of the box outwards.
+     @param[in] distance Distance to move the borders by.
+     */
+    void expand(double distance);
+
+    /** @note Borders are part of the box. */
+    bool contains(Point const& point) const;
+    bool contains(BoundingBox const& box) const;
+    bool intersects(BoundingBox const& box) const;
+
+    std::string toString() const;
+
+  private:
+    double minXCoordinate;
+    double minYCoordinate;
+    double maxXCoordinate;
+    double maxYCoordinate;
+};
+
+inline bool BoundingBox::isEmpty() const
+{
+  return minXCoordinate > maxXCoordinate;
+}
+
+inline double BoundingBox::minX() const
+{
+  return minXCoordinate;
+}
+
+inline double BoundingBox::minY() const
+{
+  return minYCoordinate;
+}
+
+inline double BoundingBox::maxX() const
+{
+  return maxXCoordinate;
+}
+
+inline double BoundingBox::maxY() const
+{
+  return maxYCoordinate;
+}
+
+#endif
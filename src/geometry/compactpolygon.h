@@ -0,0 +1,161 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/compactpolygon.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Memory efficient 2D storage of polygon's vertices.
+ *
+ * Polygon keeps three doubles per vertex plus its caches.
+ * CompactPolygon keeps only x and y of each vertex in the
+ * scalar type it is instantiated with. Coordinates are stored
+ * relative to the first vertex (kept in double), so even float
+ * instantiation keeps sub-unit precision in large cities.
+ *
+ * Geometry itself is computed in double only. Tolerances of
+ * Point::operator== and of the predicates are tuned for double,
+ * so Point, Vector, LineSegment and Polygon are not templated
+ * on the scalar type. CompactPolygon is the storage and export
+ * format for large numbers of finished areas instead (see
+ * Block::exportLots()): 8 bytes per vertex as float, against
+ * 24 bytes of a Point plus 24 bytes of the cached normal in
+ * Polygon. There are no geometric operations on it, further
+ * computation is done on the Polygon from toPolygon().
+ *
+ */
+
+#ifndef _COMPACTPOLYGON_H_
+#define _COMPACTPOLYGON_H_
+
+#include <vector>
+#include <cstddef>
+
+#include "point.h"
+#include "polygon.h"
+
+template <typename Scalar>
+class CompactPolygon
+{
+  public:
+    CompactPolygon(); /**< Polygon without vertices */
+    explicit CompactPolygon(Polygon const& source);
+
+    /** Number of vertices */
+    unsigned int numberOfVertices() const;
+
+    /** Absolute coordinates of i-th vertex */
+    double x(unsigned int i) const;
+    double y(unsigned int i) const;
+    Point vertex(unsigned int i) const;
+
+    /** First vertex, all the others are stored relative to it. */
+    Point origin() const;
+
+    /**
+      Coordinates of vertices relative to the origin.
+     @remarks
+       Stored interleaved as x0, y0, x1, y1, ... and suitable
+       for direct upload as a vertex buffer.
+     */
+    Scalar const* data() const;
+
+    /** Memory used by the vertices in bytes. */
+    size_t bytes() const;
+
+    /** Polygon with the same vertices (z is set to 0). */
+    Polygon toPolygon() const;
+
+  private:
+    double originX;
+    double originY;
+
+    std::vector<Scalar> coordinates;
+};
+
+/** Storage for bulk export of areas. */
+typedef CompactPolygon<float> FloatPolygon;
+
+/* Inlines */
+
+template <typename Scalar>
+inline CompactPolygon<Scalar>::CompactPolygon()
+  : originX(0), originY(0)
+{}
+
+template <typename Scalar>
+inline CompactPolygon<Scalar>::CompactPolygon(Polygon const& source)
+  : originX(0), originY(0)
+{
+  unsigned int vertexCount = source.numberOfVertices();
+  if (vertexCount == 0)
+  {
+    return;
+  }
+
+  originX = source.vertex(0).x();
+  originY = source.vertex(0).y();
+
+  coordinates.reserve(2*vertexCount);
+  for (unsigned int i = 0; i < vertexCount; i++)
+  {
+    Point current = source.vertex(i);
+    coordinates.push_back(static_cast<Scalar>(current.x() - originX));
+    coordinates.push_back(static_cast<Scalar>(current.y() - originY));
+  }
+}
+
+template <typename Scalar>
+inline unsigned int CompactPolygon<Scalar>::numberOfVertices() const
+{
+  return coordinates.size() / 2;
+}
+
+template <typename Scalar>
+inline double CompactPolygon<Scalar>::x(unsigned int i) const
+{
+  return originX + coordinates[2*i];
+}
+
+template <typename Scalar>
+inline double CompactPolygon<Scalar>::y(unsigned int i) const
+{
+  return originY + coordinates[2*i + 1];
+}
+
+template <typename Scalar>
+inline Point CompactPolygon<Scalar>::vertex(unsigned int i) const
+{
+  return Point(x(i), y(i));
+}
+
+template <typename Scalar>
+inline Point CompactPolygon<Scalar>::origin() const
+{
+  return Point(originX, originY);
+}
+
+template <typename Scalar>
+inline Scalar const* CompactPolygon<Scalar>::data() const
+{
+  return coordinates.empty() ? 0 : &coordinates[0];
+}
+
+template <typename Scalar>
+inline size_t CompactPolygon<Scalar>::bytes() const
+{
+  return coordinates.capacity() * sizeof(Scalar);
+}
+
+template <typename Scalar>
+inline Polygon CompactPolygon<Scalar>::toPolygon() const
+{
+  Polygon result;
+  for (unsigned int i = 0; i < numberOfVertices(); i++)
+  {
+    result.addVertex(vertex(i));
+  }
+  return result;
+}
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/kernel.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Basic geometric predicates on plain coordinates.
+ *
+ * Point, Vector and the line classes compute their products
+ * through these functions. They are defined in the header
+ * so the compiler can inline them into the hot loops.
+ *
+ */
+
+#ifndef _KERNEL_H_
+#define _KERNEL_H_
+
+namespace libcity
+{
+  /**
+    Dot product of two 2D vectors.
+   */
+  inline double dot2D(double ax, double ay, double bx, double by)
+  {
+    return ax*bx + ay*by;
+  }
+
+  /**
+    Dot product of two 3D vectors.
+   */
+  inline double dot3D(double ax, double ay, double az,
+                      double bx, double by, double bz)
+  {
+    return ax*bx + ay*by + az*bz;
+  }
+
+  /**
+    Z component of the cross product of two 2D vectors
+    (the 'perp dot' product).
+   */
+  inline double cross2D(double ax, double ay, double bx, double by)
+  {
+    return ax*by - bx*ay;
+  }
+
+  /**
+    Orientation of point c relative to the directed line
+    going from a to b.
+   @return Positive when c lies left of the line (counter
+           clockwise turn), negative when it lies right and
+           zero when the three points are collinear. The
+           absolute value is twice the area of the triangle.
+   */
+  inline double orient2d(double ax, double ay,
+                         double bx, double by,
+                         double cx, double cy)
+  {
+    return (bx - ax)*(cy - ay) - (by - ay)*(cx - ax);
+  }
+
+  /**
+    Squared distance of two points in the plane.
+   */
+  inline double squaredDistance2D(double ax, double ay, double bx, double by)
+  {
+    return (bx - ax)*(bx - ax) + (by - ay)*(by - ay);
+  }
+
+  /**
+    Squared distance of two points in space.
+   */
+  inline double squaredDistance3D(double ax, double ay, double az,
+                                  double bx, double by, double bz)
+  {
+    return (bx - ax)*(bx - ax) + (by - ay)*(by - ay) + (bz - az)*(bz - az);
+  }
+}
+
+#endif
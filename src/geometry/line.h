@@ -18,7 +18,8 @@
 
 #include <string>
 
-class Point;
+#include "point.h"
+
 class Vector;
 
 class Line
@@ -63,8 +64,8 @@ class Line
     bool operator==(Line const& another) const;
 
   protected:
-    Point *first;
-    Point *second;
+    Point first;
+    Point second;
 };
 
 #endif
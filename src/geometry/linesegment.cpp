@@ -14,10 +14,13 @@
 #include "polygon.h"
 #include "vector.h"
 #include "units.h"
+#include "kernel.h"
 #include "../debug.h"
 
 #include <cmath>
 
+const double LineSegment::BOX_TOLERANCE = 2;
+
 LineSegment::LineSegment()
   : Line()
 {}
@@ -36,8 +39,8 @@ LineSegment::LineSegment(LineSegment const& source)
 
 LineSegment& LineSegment::operator=(LineSegment const& source)
 {
-  *first  = source.begining();
-  *second = source.end();
+  first  = source.begining();
+  second = source.end();
   return *this;
 }
 
@@ -46,8 +49,9 @@ LineSegment::~LineSegment()
 
 bool LineSegment::hasPoint2D(Point const& point) const
 {
-  double lineTest = (point.x() - first->x()) * (second->y() - first->y()) -
-                    (point.y() - first->y()) * (second->x() - first->x());
+  double lineTest = libcity::orient2d(first.x(), first.y(),
+                                      second.x(), second.y(),
+                                      point.x(), point.y());
 //   debug(std::abs(lineTest));
 //   debug(toString());
 //   debug(point.toString());
@@ -55,21 +59,21 @@ bool LineSegment::hasPoint2D(Point const& point) const
   /* Point is on the line */
   {
     double t = 0.0;
-    if (std::abs(first->x() - second->x()) > libcity::COORDINATES_EPSILON) //(first->x() != second->x()) 
+    if (std::abs(first.x() - second.x()) > libcity::COORDINATES_EPSILON) //(first.x() != second.x()) 
     {
-      t = (point.x() - first->x()) / (second->x() - first->x());
+      t = (point.x() - first.x()) / (second.x() - first.x());
       //debug(t);
       return t >= 0 && t <= 1;
     }
-    else if (std::abs(first->y() - second->y()) > libcity::COORDINATES_EPSILON) //(first->y() != second->y())
+    else if (std::abs(first.y() - second.y()) > libcity::COORDINATES_EPSILON) //(first.y() != second.y())
     {
-      t = (point.y() - first->y()) / (second->y() - first->y());
+      t = (point.y() - first.y()) / (second.y() - first.y());
       //debug(t);
       return t >= 0 && t <= 1;
     }
     else
     {
-      return (*first) == point;
+      return first == point;
     }
   }
 
@@ -196,32 +200,32 @@ Point LineSegment::nearestPoint(Point const& point) const
   double parameter;
   Point orthogonalProjection;
 
-  parameter = (second->x() - first->x())*(point.x() - first->x()) +
-              (second->y() - first->y())*(point.y() - first->y()) +
-              (second->z() - first->z())*(point.z() - first->z());
+  parameter = (second.x() - first.x())*(point.x() - first.x()) +
+              (second.y() - first.y())*(point.y() - first.y()) +
+              (second.z() - first.z())*(point.z() - first.z());
 
   parameter /= length()*length();
 
   if (parameter >= 0 && parameter <=1)
   {
-    orthogonalProjection.setX((1 - parameter)*first->x() + second->x()*parameter);
-    orthogonalProjection.setY((1 - parameter)*first->y() + second->y()*parameter);
-    orthogonalProjection.setZ((1 - parameter)*first->z() + second->z()*parameter);
+    orthogonalProjection.setX((1 - parameter)*first.x() + second.x()*parameter);
+    orthogonalProjection.setY((1 - parameter)*first.y() + second.y()*parameter);
+    orthogonalProjection.setZ((1 - parameter)*first.z() + second.z()*parameter);
 
     return orthogonalProjection;
   }
   else
   {
-    double distanceToFirst  = Vector(point, *first).length();
-    double distanceToSecond = Vector(point, *second).length();
+    double distanceToFirst  = Vector(point, first).length();
+    double distanceToSecond = Vector(point, second).length();
 
     if (distanceToFirst < distanceToSecond)
     {
-      return *first;
+      return first;
     }
     else
     {
-      return *second;
+      return second;
     }
   }
 }
@@ -235,7 +239,7 @@ double LineSegment::distance(Point const& point) const
 
 double LineSegment::length() const
 {
-  Vector directionVector(*first, *second);
+  Vector directionVector(first, second);
   return directionVector.length();
 }
 
@@ -247,7 +251,7 @@ bool LineSegment::operator==(LineSegment const& another) const
 
 Vector LineSegment::normal() const
 {
-  Vector direction = *second - *first;
+  Vector direction = second - first;
 
   return Vector(-direction.y(), direction.x());
 }
@@ -255,5 +259,5 @@ Vector LineSegment::normal() const
 
 std::string LineSegment::toString() const
 {
-  return "LineSegment(" + first->toString() + ", " + second->toString() + ")";
+  return "LineSegment(" + first.toString() + ", " + second.toString() + ")";
 }
@@ -36,7 +36,19 @@ class LineSegment : public Line
     double length() const;
 
     Vector normal() const;
+
+    /**
+      Is the point on the segment?
+     @remarks
+       Points closer than COORDINATES_EPSILON / |d| to the line are
+       on it (d is the longer coordinate difference of the segment,
+       |d| > COORDINATES_EPSILON), so a point on the segment is never
+       further than one unit from its bounding box. BOX_TOLERANCE
+       is that distance with some reserve.
+     */
     bool hasPoint2D(Point const& point) const;
+    static const double BOX_TOLERANCE;
+
     Intersection intersection2D(LineSegment const& another, Point* intersection) const;
     Intersection intersection2D(Line const& another, Point* intersection) const;
     double distance(Point const& point) const;
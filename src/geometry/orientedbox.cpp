@@ -0,0 +1,131 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/orientedbox.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see geometry/orientedbox.h
+ *
+ */
+
+#include "orientedbox.h"
+#include "polygon.h"
+#include "../debug.h"
+
+#include <sstream>
+#include <string>
+
+OrientedBox::OrientedBox()
+  : mainAxis(1, 0), lengthAlongAxis(0), widthAlongNormal(0), empty(true)
+{}
+
+OrientedBox::OrientedBox(Polygon const& polygon)
+  : mainAxis(1, 0), lengthAlongAxis(0), widthAlongNormal(0), empty(true)
+{
+  if (polygon.numberOfVertices() > 0)
+  {
+    fit(polygon.convexHull());
+  }
+}
+
+void OrientedBox::fit(Polygon const& hull)
+{
+  int size = hull.numberOfVertices();
+  empty = false;
+
+  if (size == 1)
+  {
+    centerPoint = hull.vertex(0);
+    return;
+  }
+
+  if (size == 2)
+  {
+    mainAxis = hull.vertex(1) - hull.vertex(0);
+    lengthAlongAxis = mainAxis.length();
+    mainAxis.normalize();
+    centerPoint = hull.vertex(0) + mainAxis*(lengthAlongAxis / 2);
+    return;
+  }
+
+  /* Calipers touching the hull at the right, top and left side
+     of the current edge only ever move forwards. */
+  int right = 0, top = 0, left = 0;
+  double bestArea = -1;
+
+  for (int i = 0; i < size; i++)
+  {
+    Point origin = hull.vertex(i);
+    Vector direction = hull.vertex((i + 1) % size) - origin;
+    direction.normalize();
+    Vector inward(-direction.y(), direction.x());
+
+    if (i == 0)
+    {
+      for (int j = 1; j < size; j++)
+      {
+        if ((hull.vertex(j) - origin).dotProduct(direction) > (hull.vertex(right) - origin).dotProduct(direction)) right = j;
+        if ((hull.vertex(j) - origin).dotProduct(inward) > (hull.vertex(top) - origin).dotProduct(inward)) top = j;
+        if ((hull.vertex(j) - origin).dotProduct(direction) < (hull.vertex(left) - origin).dotProduct(direction)) left = j;
+      }
+    }
+    else
+    {
+      while ((hull.vertex((right + 1) % size) - hull.vertex(right)).dotProduct(direction) > 0)
+      {
+        right = (right + 1) % size;
+      }
+      while ((hull.vertex((top + 1) % size) - hull.vertex(top)).dotProduct(inward) > 0)
+      {
+        top = (top + 1) % size;
+      }
+      while ((hull.vertex((left + 1) % size) - hull.vertex(left)).dotProduct(direction) < 0)
+      {
+        left = (left + 1) % size;
+      }
+    }
+
+    double minimum = (hull.vertex(left) - origin).dotProduct(direction);
+    double maximum = (hull.vertex(right) - origin).dotProduct(direction);
+    double height = (hull.vertex(top) - origin).dotProduct(inward);
+    double area = (maximum - minimum)*height;
+
+    if (bestArea < 0 || area < bestArea)
+    {
+      bestArea = area;
+      centerPoint = origin + direction*((minimum + maximum) / 2) + inward*(height / 2);
+
+      if (maximum - minimum >= height)
+      {
+        mainAxis = direction;
+        lengthAlongAxis = maximum - minimum;
+        widthAlongNormal = height;
+      }
+      else
+      {
+        /* Keep the box counter-clockwise with the longer side first. */
+        mainAxis = inward;
+        lengthAlongAxis = height;
+        widthAlongNormal = maximum - minimum;
+      }
+    }
+  }
+}
+
+Point OrientedBox::corner(unsigned int number) const
+{
+  assert(number < 4);
+
+  static const double signs[4][2] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+  return centerPoint + mainAxis*(signs[number][0]*lengthAlongAxis / 2) +
+                       normal()*(signs[number][1]*widthAlongNormal / 2);
+}
+
+std::string OrientedBox::toString() const
+{
+  std::stringstream convertor;
+  convertor << "OrientedBox(" << centerPoint.toString() << ", " << mainAxis.toString() << ", "
+                              << lengthAlongAxis << ", " << widthAlongNormal << ")";
+  return convertor.str();
+}
@@ -0,0 +1,107 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/orientedbox.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Minimal area rectangle around a polygon.
+ *
+ * The rectangle is found by rotating calipers around the
+ * polygon's convex hull. One of its sides always lies on
+ * an edge of the hull. Computation takes O(n log n) because
+ * of the hull, the calipers themselves are linear.
+ *
+ */
+
+#ifndef _ORIENTEDBOX_H_
+#define _ORIENTEDBOX_H_
+
+#include <string>
+
+#include "point.h"
+#include "vector.h"
+
+class Polygon;
+
+class OrientedBox
+{
+  public:
+    OrientedBox(); /**< Empty box */
+    explicit OrientedBox(Polygon const& polygon); /**< Minimal box around the polygon */
+
+    /** Box of a polygon without vertices. */
+    bool isEmpty() const;
+
+    Point center() const;
+
+    /** Unit vector along the longer side. */
+    Vector axis() const;
+
+    /** Unit vector along the shorter side. */
+    Vector normal() const;
+
+    /** Size along the axis. */
+    double length() const;
+
+    /** Size along the normal. */
+    double width() const;
+
+    double area() const;
+
+    /**
+      Corners of the box, counter-clockwise.
+     @param[in] number Number of the corner from 0 to 3.
+     */
+    Point corner(unsigned int number) const;
+
+    std::string toString() const;
+
+  private:
+    Point centerPoint;
+    Vector mainAxis;
+    double lengthAlongAxis;
+    double widthAlongNormal;
+    bool empty;
+
+    void fit(Polygon const& hull);
+};
+
+/* Inlines */
+
+inline bool OrientedBox::isEmpty() const
+{
+  return empty;
+}
+
+inline Point OrientedBox::center() const
+{
+  return centerPoint;
+}
+
+inline Vector OrientedBox::axis() const
+{
+  return mainAxis;
+}
+
+inline Vector OrientedBox::normal() const
+{
+  return Vector(-mainAxis.y(), mainAxis.x());
+}
+
+inline double OrientedBox::length() const
+{
+  return lengthAlongAxis;
+}
+
+inline double OrientedBox::width() const
+{
+  return widthAlongNormal;
+}
+
+inline double OrientedBox::area() const
+{
+  return lengthAlongAxis*widthAlongNormal;
+}
+
+#endif
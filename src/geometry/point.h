@@ -7,12 +7,19 @@
  *
  * @brief Point in 3D space. But can also represent 2D and 1D points.
  *
+ * All the operations except conversion to string are inline.
+ * Operations involving Vector are defined in vector.h, which
+ * is included at the end of this file.
+ *
  */
 
 #ifndef _POINT_H_
 #define _POINT_H_
 
 #include <string>
+#include <cmath>
+
+#include "units.h"
 
 class Vector;
 
@@ -22,9 +29,6 @@ class Point
     Point(); /**< [0,0,0] */
     Point(double const& x, double const& y); /**< 2D */
     Point(double const& x, double const& y, double const& z); /**< 3D */
-    Point(Point const& source);
-
-    ~Point();
 
     std::string toString() const;
 
@@ -43,17 +47,29 @@ class Point
     void setY(double const& coordinate);
     void setZ(double const& coordinate);
 
-    bool operator==(Point const& second);
-    bool operator!=(Point const& second);
-    bool operator<(Point const& second);
-    bool operator>(Point const& second);
+    bool operator==(Point const& second) const;
+    bool operator!=(Point const& second) const;
+    bool operator<(Point const& second) const;
+    bool operator>(Point const& second) const;
 
     Point& operator+=(Vector const& difference);
     Point  operator+(Vector const& difference) const;
 
-    Vector operator-(Point const& second);
+    Vector operator-(Point const& second) const;
 };
 
+inline Point::Point()
+  : xPosition(0), yPosition(0), zPosition(0)
+{}
+
+inline Point::Point(double const& x, double const& y)
+  : xPosition(x), yPosition(y), zPosition(0)
+{}
+
+inline Point::Point(double const& x, double const& y, double const& z)
+  : xPosition(x), yPosition(y), zPosition(z)
+{}
+
 inline double Point::x() const
 {
   return xPosition;
@@ -69,6 +85,13 @@ inline double Point::z() const
   return zPosition;
 }
 
+inline void Point::set(double const& xCoord, double const& yCoord, double const& zCoord)
+{
+  xPosition = xCoord;
+  yPosition = yCoord;
+  zPosition = zCoord;
+}
+
 inline void Point::setX(double const& coordinate)
 {
   xPosition = coordinate;
@@ -84,4 +107,47 @@ inline void Point::setZ(double const& coordinate)
   zPosition = coordinate;
 }
 
-#endif
\ No newline at end of file
+inline bool Point::operator==(Point const& second) const
+{
+  return std::abs(xPosition - second.xPosition) < libcity::COORDINATES_EPSILON &&
+         std::abs(yPosition - second.yPosition) < libcity::COORDINATES_EPSILON &&
+         std::abs(zPosition - second.zPosition) < libcity::COORDINATES_EPSILON;
+}
+
+inline bool Point::operator!=(Point const& second) const
+{
+  return !(*this == second);
+}
+
+inline bool Point::operator<(Point const& second) const
+{
+  if (xPosition < second.xPosition)
+  {
+    return true;
+  }
+  else if (xPosition == second.xPosition)
+  {
+    return yPosition < second.yPosition;
+  }
+
+  return false;
+}
+
+inline bool Point::operator>(Point const& second) const
+{
+  if (xPosition > second.xPosition)
+  {
+    return true;
+  }
+  else if (xPosition == second.xPosition)
+  {
+    return yPosition > second.yPosition;
+  }
+
+  return false;
+}
+
+#endif
+
+/* Point and Vector depend on each other. */
+#include "vector.h"
@@ -16,31 +16,36 @@
 #include "linesegment.h"
 #include "line.h"
 #include "ray.h"
+#include "preparedpolygon.h"
+#include "polygonoffset.h"
+#include "polygonsplitter.h"
+#include "triangulator.h"
+#include "predicates.h"
+#include "kernel.h"
 #include "../debug.h"
 
+#include <algorithm>
 #include <cmath>
-
-void Polygon::initialize()
-{
-  vertices = new std::vector<Point*>;
-}
+#include <set>
 
 Polygon::Polygon()
+  : boxIsValid(true), signedAreaIsValid(false)
 {
-  initialize();
 }
 
 Polygon::Polygon(Point const& one, Point const& two, Point const& three)
+  : boxIsValid(true), signedAreaIsValid(false)
 {
-  initialize();
+  vertices.reserve(3);
   addVertex(one);
   addVertex(two);
   addVertex(three);
 }
 
 Polygon::Polygon(Point const& one, Point const& two, Point const& three, Point const& four)
+  : boxIsValid(true), signedAreaIsValid(false)
 {
-  initialize();
+  vertices.reserve(4);
   addVertex(one);
   addVertex(two);
   addVertex(three);
@@ -48,56 +53,48 @@ Polygon::Polygon(Point const& one, Point const& two, Point const& three, Point c
 }
 
 Polygon::Polygon(Polygon const& source)
+  : vertices(source.vertices),
+    box(source.box),
+    boxIsValid(source.boxIsValid),
+    cachedSignedArea(source.cachedSignedArea),
+    signedAreaIsValid(source.signedAreaIsValid),
+    inwardNormals(source.inwardNormals)
 {
-  initialize();
-
-  for (std::vector<Point*>::iterator vertex = source.vertices->begin();
-       vertex != source.vertices->end();
-       vertex++)
-  {
-    addVertex(**vertex);
-  }
 }
 
 Polygon& Polygon::operator=(Polygon const& source)
 {
-  freeVertices();
-  initialize();
-
-  for (std::vector<Point*>::iterator vertex = source.vertices->begin();
-       vertex != source.vertices->end();
-       vertex++)
-  {
-    addVertex(**vertex);
-  }
+  vertices = source.vertices;
+  box = source.box;
+  boxIsValid = source.boxIsValid;
+  cachedSignedArea = source.cachedSignedArea;
+  signedAreaIsValid = source.signedAreaIsValid;
+  inwardNormals = source.inwardNormals;
 
   return *this;
 }
 
 Polygon::~Polygon()
 {
-  freeVertices();
 }
 
-void Polygon::freeVertices()
+unsigned int Polygon::numberOfVertices() const
 {
-  while (!vertices->empty())
-  {
-    delete vertices->back();
-    vertices->pop_back();
-  }
-
-  delete vertices;
+  return vertices.size();
 }
 
-unsigned int Polygon::numberOfVertices() const
+void Polygon::clear()
 {
-  return vertices->size();
+  vertices.clear();
+  box = BoundingBox();
+  boxIsValid = true;
+  invalidateCache();
 }
 
-void Polygon::clear()
+void Polygon::invalidateCache()
 {
-  vertices->clear();
+  signedAreaIsValid = false;
+  inwardNormals.clear();
 }
 
 void Polygon::addVertex(Point const& vertex)
@@ -105,7 +102,7 @@ void Polygon::addVertex(Point const& vertex)
   /* To avoid zero length edges. */
   if (numberOfVertices() > 0)
   {
-    double distanceFromLast = Vector(vertex, *vertices->back()).length();
+    double distanceFromLast = Vector(vertex, vertices.back()).length();
 
     if (distanceFromLast <= libcity::COORDINATES_EPSILON)
     {
@@ -113,33 +110,71 @@ void Polygon::addVertex(Point const& vertex)
     }
   }
 
-  vertices->push_back(new Point(vertex));
+  vertices.push_back(vertex);
+  if (boxIsValid)
+  {
+    box.include(vertex);
+  }
+  invalidateCache();
 
   // FIXME: check if the vertex is in a plane with other vertices!
 }
 
 void Polygon::updateVertex(unsigned int number, Point const& vertex)
 {
-  assert(number < vertices->size());
-  *vertices->at(number) = vertex;
+  assert(number < vertices.size());
+  vertexLeavesBox(vertices[number]);
+  vertices[number] = vertex;
+  if (boxIsValid)
+  {
+    box.include(vertex);
+  }
+  invalidateCache();
 }
 
 void Polygon::removeVertex(unsigned int number)
 {
-  if (number >= vertices->size())
+  if (number >= vertices.size())
   {
     // FIXME throw out of range exception
   }
 
-  Point *removedVertex = vertices->at(number);
-  vertices->erase(vertices->begin() + number);
-  delete removedVertex;
+  vertexLeavesBox(vertices[number]);
+  vertices.erase(vertices.begin() + number);
+  invalidateCache();
+}
+
+void Polygon::vertexLeavesBox(Point const& vertex)
+{
+  if (boxIsValid &&
+      (vertex.x() == box.minX() || vertex.x() == box.maxX() ||
+       vertex.y() == box.minY() || vertex.y() == box.maxY()))
+  {
+    boxIsValid = false;
+  }
+}
+
+BoundingBox Polygon::aabb() const
+{
+  if (!boxIsValid)
+  {
+    box = BoundingBox();
+    for (std::vector<Point>::const_iterator vertex = vertices.begin();
+         vertex != vertices.end();
+         vertex++)
+    {
+      box.include(*vertex);
+    }
+    boxIsValid = true;
+  }
+
+  return box;
 }
 
 Point Polygon::vertex(unsigned int number) const
 {
   assert(number < numberOfVertices());
-  return *vertices->at(number);
+  return vertices[number];
 }
 
 LineSegment Polygon::edge(unsigned int number) const
@@ -147,7 +182,7 @@ LineSegment Polygon::edge(unsigned int number) const
   assert(numberOfVertices() >= 2);
   assert(number < (numberOfVertices()));
 
-  return LineSegment(*vertices->at(number), *vertices->at((number + 1) % numberOfVertices()));
+  return LineSegment(vertices[number], vertices[(number + 1) % numberOfVertices()]);
 }
 
 double Polygon::area() const
@@ -157,22 +192,35 @@ double Polygon::area() const
 
 double Polygon::signedArea() const
 {
+  if (signedAreaIsValid)
+  {
+    return cachedSignedArea;
+  }
+
   double area = 0;
 
   unsigned int currentVertexPosition = 0,
                count = numberOfVertices();
-  Point *currentVertex = 0,
-        *nextVertex = 0;
+  Point const *currentVertex = 0,
+              *nextVertex = 0;
 
   for (currentVertexPosition = 0; currentVertexPosition < count; currentVertexPosition++)
   {
-    currentVertex = vertices->at(currentVertexPosition);
-    nextVertex    = vertices->at((currentVertexPosition + 1) % count);
+    currentVertex = &vertices[currentVertexPosition];
+    nextVertex    = &vertices[(currentVertexPosition + 1) % count];
 
     area += currentVertex->x() * nextVertex->y() - currentVertex->y() * nextVertex->x();
   }
 
-  return area/2;
+  cachedSignedArea = area/2;
+  signedAreaIsValid = true;
+
+  return cachedSignedArea;
+}
+
+bool Polygon::isCounterclockwise() const
+{
+  return signedArea() > 0;
 }
 
 Point Polygon::centroid() const
@@ -184,13 +232,13 @@ Point Polygon::centroid() const
 
   unsigned int currentVertexPosition = 0,
                count = numberOfVertices();
-  Point *currentVertex = 0,
-        *nextVertex = 0;
+  Point const *currentVertex = 0,
+              *nextVertex = 0;
 
   for (currentVertexPosition = 0; currentVertexPosition < count; currentVertexPosition++)
   {
-    currentVertex = vertices->at(currentVertexPosition);
-    nextVertex    = vertices->at((currentVertexPosition + 1) % count);
+    currentVertex = &vertices[currentVertexPosition];
+    nextVertex    = &vertices[(currentVertexPosition + 1) % count];
 
     areaStep = currentVertex->x() * nextVertex->y() - nextVertex->x() * currentVertex->y();
     area += areaStep;
@@ -205,18 +253,26 @@ Point Polygon::centroid() const
 
 bool Polygon::encloses2D(Point const& point) const
 {
+  BoundingBox area = aabb();
+  area.expand(LineSegment::BOX_TOLERANCE);
+  if (!area.contains(point))
+  /* Too far from all the edges and crossings sum up to even number. */
+  {
+    return false;
+  }
+
   unsigned int currentVertexPosition = 0,
                count = numberOfVertices();
-  Point *currentVertex = 0,
-        *nextVertex = 0;
+  Point const *currentVertex = 0,
+              *nextVertex = 0;
   LineSegment currentLine;
 
   bool isInside = false;
 
   for (currentVertexPosition = 0; currentVertexPosition < count; currentVertexPosition++)
   {
-    currentVertex = vertices->at(currentVertexPosition);
-    nextVertex    = vertices->at((currentVertexPosition + 1) % count);
+    currentVertex = &vertices[currentVertexPosition];
+    nextVertex    = &vertices[(currentVertexPosition + 1) % count];
 
     /* The algorithm is unreilable at the edges so
      * we check them separately to make sure. */
@@ -244,7 +300,7 @@ Vector Polygon::normal() const
 {
   assert(numberOfVertices() >= 3);
 
-  Vector first(*vertices->at(1), *vertices->at(0)),
+  Vector first(vertices[1], vertices[0]),
          second;
 
   first.normalize();
@@ -254,7 +310,7 @@ Vector Polygon::normal() const
   {
     current = i;
     next = (i + 1) % verticesCount;
-    second.set(*vertices->at(current), *vertices->at(next));
+    second.set(vertices[current], vertices[next]);
     second.normalize();
 
     /* Edges are not parallel */
@@ -271,6 +327,60 @@ Vector Polygon::normal() const
 }
 
 Vector Polygon::edgeNormal(unsigned int edgeNumber) const
+{
+  assert(edgeNumber < numberOfVertices());
+
+  if (inwardNormals.empty())
+  {
+    computeInwardNormals();
+  }
+
+  return inwardNormals[edgeNumber];
+}
+
+void Polygon::computeInwardNormals() const
+{
+  unsigned int verticesNumber = numberOfVertices();
+  inwardNormals.reserve(verticesNumber);
+
+  double area = signedArea();
+  if (area == 0 || !isInPlaneXY())
+  /* Orientation doesn't tell where the inside is. */
+  {
+    for (unsigned int i = 0; i < verticesNumber; i++)
+    {
+      inwardNormals.push_back(edgeNormalByRay(i));
+    }
+    return;
+  }
+
+  for (unsigned int i = 0; i < verticesNumber; i++)
+  {
+    Point const& first  = vertices[i];
+    Point const& second = vertices[(i + 1) % verticesNumber];
+
+    /* Right side of the edge, inside of a clockwise polygon. */
+    Vector normalVector(second.y() - first.y(), first.x() - second.x(), 0);
+    normalVector.normalize();
+
+    inwardNormals.push_back(area > 0 ? normalVector*(-1) : normalVector);
+  }
+}
+
+bool Polygon::isInPlaneXY() const
+{
+  for (unsigned int i = 1; i < numberOfVertices(); i++)
+  {
+    if (vertices[i].z() != vertices[0].z())
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+Vector Polygon::edgeNormalByRay(unsigned int edgeNumber) const
 {
   unsigned int verticesNumber = numberOfVertices();
   assert(edgeNumber < verticesNumber);
@@ -278,15 +388,15 @@ Vector Polygon::edgeNormal(unsigned int edgeNumber) const
   int first  = edgeNumber;
   int second = (edgeNumber + 1) % verticesNumber;
 
-  Vector direction(*(vertices->at(first)), *(vertices->at(second))),
+  Vector direction(vertices[first], vertices[second]),
          normalVector;
 
   normalVector = direction.crossProduct(normal());
   normalVector.normalize();
 
-  Point edgeCenter((vertices->at(first)->x() + vertices->at(second)->x())/2,
-                   (vertices->at(first)->y() + vertices->at(second)->y())/2,
-                   (vertices->at(first)->z() + vertices->at(second)->z())/2);
+  Point edgeCenter((vertices[first].x() + vertices[second].x())/2,
+                   (vertices[first].y() + vertices[second].y())/2,
+                   (vertices[first].z() + vertices[second].z())/2);
 
   Ray testRay(edgeCenter, normalVector);
 
@@ -315,145 +425,64 @@ Vector Polygon::edgeNormal(unsigned int edgeNumber) const
 
 bool Polygon::isSubAreaOf(Polygon const& biggerPolygon)
 {
-  for (unsigned int i = 0; i < numberOfVertices(); i++)
+  BoundingBox area = biggerPolygon.aabb();
+  area.expand(LineSegment::BOX_TOLERANCE);
+  if (numberOfVertices() > 0 && !area.contains(aabb()))
+  /* Some vertex is outside. */
   {
-    if (!biggerPolygon.encloses2D(*(*vertices)[i]))
-    {
-      return false;
-    }
+    return false;
   }
 
-  return true;
+  PreparedPolygon preparedPolygon(biggerPolygon);
+  std::vector<bool> enclosed;
+
+  return preparedPolygon.enclosesBatch(vertices, &enclosed) == numberOfVertices();
 }
 
 
-std::list<Polygon*> Polygon::split(Line const& splitLine)
+bool Polygon::mayIntersect(Line const& line) const
 {
-  std::list<Point> vertexList;
-  std::list<Point> intersections;
-
-  LineSegment currentEdge;
-  LineSegment::Intersection result;
-  Point intersection;
-
-  /* for each edge */
-  for (unsigned int i = 0; i < numberOfVertices(); i++)
-  {
-    currentEdge = edge(i);
-
-    vertexList.push_back(vertex(i));
-
-    result = currentEdge.intersection2D(splitLine, &intersection);
-    if (result == Line::INTERSECTING)
-    {
-      if (intersection != currentEdge.begining() &&
-          intersection != currentEdge.end())
-      {
-        vertexList.push_back(intersection);
-        intersections.push_back(intersection);
-      }
-      else
-      {
-        intersections.push_back(intersection);
-      }
-    }
-  }
-  intersections.sort();
-  intersections.unique();
-
-  std::list<Polygon*> stack;
-  std::list<Polygon*> output;
-  Polygon* top;
-
-  /* Split line was out or was just touching a vertex */
-  if (intersections.size() <= 1)
+  BoundingBox area = aabb();
+  if (area.isEmpty())
   {
-    output.push_back(new Polygon(*this));
-    return output;
+    return false;
   }
 
-  stack.push_back(new Polygon);
-  for (std::list<Point>::iterator vertexIterator = vertexList.begin();
-       vertexIterator != vertexList.end();
-       vertexIterator++)
-  {
-    top = stack.back();
-
-    top->addVertex(*vertexIterator);
-
-    if (isVertexIntersection(*vertexIterator, intersections))
-    {
-      if (top->numberOfVertices() > 0 && areVerticesInPair(*vertexIterator, top->vertex(0), intersections))
-      {
-        if (top->isClosed())
-        {
-          output.push_back(top);
-        }
+  /* The edges are tested with a relative tolerance in float,
+     keep far enough for that too. */
+  double margin = LineSegment::BOX_TOLERANCE + 1e-3*((area.maxX() - area.minX()) + (area.maxY() - area.minY()));
+  area.expand(margin);
 
-        stack.pop_back();
-        top = stack.back();
-        top->addVertex(*vertexIterator);
-      }
-      else
-      {
-        stack.push_back(new Polygon);
-        top = stack.back();
-        top->addVertex(*vertexIterator);
-      }
-    }
-  }
+  double length = Vector(line.begining(), line.end()).length();
+  double corners[4][2] = {{area.minX(), area.minY()}, {area.maxX(), area.minY()},
+                          {area.maxX(), area.maxY()}, {area.minX(), area.maxY()}};
 
-  if (stack.size() > 0)
+  int above = 0, below = 0;
+  for (int i = 0; i < 4; i++)
   {
-    top = stack.back();
-    if (top->isClosed())
-    {
-      output.push_back(top);
-    }
+    double distance = libcity::orient2d(line.begining().x(), line.begining().y(),
+                                        line.end().x(), line.end().y(),
+                                        corners[i][0], corners[i][1]) / length;
+    if (distance > margin) above++;
+    if (distance < -margin) below++;
   }
 
-  return output;
+  return above != 4 && below != 4;
 }
 
-bool Polygon::isVertexIntersection(Point vertex, std::list<Point> intersections)
+std::list<Polygon*> Polygon::split(Line const& splitLine)
 {
-  for (std::list<Point>::iterator vertexIterator = intersections.begin();
-       vertexIterator != intersections.end();
-       vertexIterator++)
-  {
-    if (*vertexIterator == vertex)
-    {
-      return true;
-    }
-  }
-
-  return false;
-}
+  PolygonSplitter splitter;
+  std::vector<Polygon> pieces;
+  unsigned int count = splitter.split(*this, splitLine, &pieces);
 
-bool Polygon::areVerticesInPair(Point first, Point second, std::list<Point> intersections)
-{
-  int i = 0;
-  std::list<Point>::iterator vertexIterator;
-  for (vertexIterator =intersections.begin();
-       vertexIterator != intersections.end();
-       vertexIterator++, i++)
+  std::list<Polygon*> output;
+  for (unsigned int i = 0; i < count; i++)
   {
-    if (*vertexIterator == first)
-    {
-      if (i % 2)
-      {
-        vertexIterator--;
-      }
-      else
-      {
-        vertexIterator++;
-      }
-      break;
-    }
+    output.push_back(new Polygon(pieces[i]));
   }
 
-  assert(vertexIterator != intersections.end());
-  return *vertexIterator == second;
+  return output;
 }
 
 void Polygon::rotate(double xDegrees, double yDegrees, double zDegrees)
@@ -484,37 +513,12 @@ void Polygon::scale(double factor)
 
 void Polygon::substract(double distance)
 {
-  int previous, current, next;
-  int verticesCount = numberOfVertices();
-  Line first, second;
-  Vector firstNormal, secondNormal;
-  Line::Intersection result;
-  Point newVertex;
-  Polygon oldArea(*this);
+  PolygonOffset offset;
+  std::vector<double> distances(numberOfVertices(), distance);
 
-  for(int i = 0; i < verticesCount; i++)
+  if (!offset.offset(this, distances))
   {
-    previous = (i-1) < 0 ? verticesCount-1 : i-1;
-    current = i;
-    next = (i + 1) % verticesCount;
-
-    firstNormal = oldArea.edgeNormal(previous);
-    firstNormal.normalize();
-    first.setBegining(oldArea.vertex(previous) + firstNormal*distance);
-    first.setEnd(oldArea.vertex(current) + firstNormal*distance);
-
-    secondNormal = oldArea.edgeNormal(current);
-    secondNormal.normalize();
-    second.setBegining(oldArea.vertex(current) + secondNormal*distance);
-    second.setEnd(oldArea.vertex(next) + secondNormal*distance);
-
-    result = first.intersection2D(second, &newVertex);
-    if (result == Line::PARALLEL)
-    {
-      newVertex = oldArea.vertex(current) + firstNormal*distance;
-    }
-
-    updateVertex(current, newVertex);
+    clear();
   }
 }
 
@@ -555,172 +559,312 @@ void Polygon::substractEdge(int edgeNumber, double distance)
 
 }
 
-bool Polygon::isNonSelfIntersecting()
+namespace
 {
-  std::vector<Point> points;
-  std::vector<int> sequence;
+  /* Edge with its end points sorted from left to right. */
+  struct SweepSegment
+  {
+    Point left;
+    Point right;
+  };
 
-  return triangulation(&points, &sequence);
+  struct SweepEvent
+  {
+    Point position;
+    bool isLeft;
+    unsigned int segment;
 
-}
+    bool operator<(SweepEvent const& another) const
+    {
+      if (position.x() != another.position.x()) return position.x() < another.position.x();
+      if (position.y() != another.position.y()) return position.y() < another.position.y();
+      /* Segments starting at a point are inserted before the
+         ones ending there are removed, so they meet. */
+      if (isLeft != another.isLeft) return isLeft;
+      return segment < another.segment;
+    }
+  };
 
-bool Polygon::isClosed() const
-{
-  return numberOfVertices() >= 3;
-}
+  bool isLeftOf(Point const& first, Point const& second)
+  {
+    return first.x() < second.x() || (first.x() == second.x() && first.y() < second.y());
+  }
 
-std::string Polygon::toString() const
-{
-  std::string output = "Polygon(";
+  double orientation(Point const& a, Point const& b, Point const& c)
+  {
+    return libcity::orient2dRobust(a.x(), a.y(), b.x(), b.y(), c.x(), c.y());
+  }
 
-  for (unsigned int i = 0; i < numberOfVertices(); i++)
+  /* Is point (known to be on the line of segment) inside its box? */
+  bool isWithin(SweepSegment const& segment, Point const& point)
   {
-    output += (*vertices)[i]->toString() + ", ";
+    return point.x() >= segment.left.x() && point.x() <= segment.right.x() &&
+           point.y() >= std::min(segment.left.y(), segment.right.y()) &&
+           point.y() <= std::max(segment.left.y(), segment.right.y());
   }
-  return output + ").";
-}
 
+  /* Order of active segments along the sweep line, bottom to top. */
+  class SweepOrder
+  {
+    public:
+      SweepOrder(std::vector<SweepSegment> const* sweptSegments)
+        : segments(sweptSegments)
+      {}
 
+      bool operator()(unsigned int first, unsigned int second) const
+      {
+        if (first == second) return false;
 
-   /*
-     isInsideTriangle decides if a point P is Inside of the triangle
-     defined by A, B, C.
-   */
-bool Polygon::isInsideTriangle(double Ax, double Ay,
-                      double Bx, double By,
-                      double Cx, double Cy,
-                      double Px, double Py)
+        SweepSegment const& a = (*segments)[first];
+        SweepSegment const& b = (*segments)[second];
 
-{
-  double ax, ay, bx, by, cx, cy, apx, apy, bpx, bpy, cpx, cpy;
-  double cCROSSap, bCROSScp, aCROSSbp;
+        /* Compare at the left end of the later one. */
+        bool aStartsFirst = !isLeftOf(b.left, a.left);
+        SweepSegment const& earlier = aStartsFirst ? a : b;
+        SweepSegment const& later   = aStartsFirst ? b : a;
 
-  ax = Cx - Bx;  ay = Cy - By;
-  bx = Ax - Cx;  by = Ay - Cy;
-  cx = Bx - Ax;  cy = By - Ay;
-  apx= Px - Ax;  apy= Py - Ay;
-  bpx= Px - Bx;  bpy= Py - By;
-  cpx= Px - Cx;  cpy= Py - Cy;
+        double side = orientation(earlier.left, earlier.right, later.left);
+        if (side == 0)
+        {
+          side = orientation(earlier.left, earlier.right, later.right);
+        }
+        if (side == 0)
+        /* Collinear, any consistent order will do. */
+        {
+          return first < second;
+        }
 
-  aCROSSbp = ax*bpy - ay*bpx;
-  cCROSSap = cx*apy - cy*apx;
-  bCROSScp = bx*cpy - by*cpx;
+        /* Later segment above the earlier one? */
+        return aStartsFirst ? side > 0 : side < 0;
+      }
 
-  return ((aCROSSbp >= 0.0) && (bCROSScp >= 0.0) && (cCROSSap >= 0.0));
+    private:
+      std::vector<SweepSegment> const* segments;
+  };
 }
 
-bool Polygon::snip(int u,int v,int w,int n,int *V)
+bool Polygon::edgesIntersect(unsigned int first, unsigned int second) const
 {
-  int p;
-  double Ax, Ay, Bx, By, Cx, Cy, Px, Py;
+  unsigned int count = numberOfVertices();
+  Point const& a = vertices[first];
+  Point const& b = vertices[(first + 1) % count];
+  Point const& c = vertices[second];
+  Point const& d = vertices[(second + 1) % count];
 
-  Ax = (*vertices)[V[u]]->x();
-  Ay = (*vertices)[V[u]]->y();
-
-  Bx = (*vertices)[V[v]]->x();
-  By = (*vertices)[V[v]]->y();
+  if ((first + 1) % count == second || (second + 1) % count == first)
+  /* Neighbours share a vertex, they may only fold back over each other. */
+  {
+    Point const& shared = (first + 1) % count == second ? b : a;
+    Point const& firstOther = (first + 1) % count == second ? a : b;
+    Point const& secondOther = (first + 1) % count == second ? d : c;
 
-  Cx = (*vertices)[V[w]]->x();
-  Cy = (*vertices)[V[w]]->y();
+    if (count == 3 || orientation(shared, firstOther, secondOther) != 0)
+    {
+      return false;
+    }
 
-  if ( libcity::EPSILON > (((Bx-Ax)*(Cy-Ay)) - ((By-Ay)*(Cx-Ax))) )
-  {
-    return false;
+    return (firstOther.x() - shared.x())*(secondOther.x() - shared.x()) +
+           (firstOther.y() - shared.y())*(secondOther.y() - shared.y()) > 0;
   }
 
-  for (p=0;p<n;p++)
+  double o1 = orientation(a, b, c),
+         o2 = orientation(a, b, d),
+         o3 = orientation(c, d, a),
+         o4 = orientation(c, d, b);
+
+  if (((o1 > 0 && o2 < 0) || (o1 < 0 && o2 > 0)) &&
+      ((o3 > 0 && o4 < 0) || (o3 < 0 && o4 > 0)))
   {
-    if( (p == u) || (p == v) || (p == w) ) continue;
-    Px = (*vertices)[V[p]]->x();
-    Py = (*vertices)[V[p]]->y();
-    if (isInsideTriangle(Ax,Ay,Bx,By,Cx,Cy,Px,Py)) return false;
+    return true;
   }
 
-  return true;
+  SweepSegment firstSegment, secondSegment;
+  firstSegment.left   = isLeftOf(a, b) ? a : b;
+  firstSegment.right  = isLeftOf(a, b) ? b : a;
+  secondSegment.left  = isLeftOf(c, d) ? c : d;
+  secondSegment.right = isLeftOf(c, d) ? d : c;
+
+  /* Touching */
+  return (o1 == 0 && isWithin(firstSegment, c)) ||
+         (o2 == 0 && isWithin(firstSegment, d)) ||
+         (o3 == 0 && isWithin(secondSegment, a)) ||
+         (o4 == 0 && isWithin(secondSegment, b));
 }
 
-std::vector<Point> Polygon::triangulate()
+bool Polygon::isNonSelfIntersecting(unsigned int* firstEdge, unsigned int* secondEdge) const
 {
-  std::vector<Point> points;
-  std::vector<int> sequence;
+  unsigned int count = numberOfVertices();
 
-  triangulation(&points, &sequence);
+  std::vector<SweepSegment> segments(count);
+  std::vector<SweepEvent> events;
+  events.reserve(2*count);
 
-  return points;
-}
+  for (unsigned int i = 0; i < count; i++)
+  {
+    Point const& begining = vertices[i];
+    Point const& end = vertices[(i + 1) % count];
+
+    segments[i].left  = isLeftOf(begining, end) ? begining : end;
+    segments[i].right = isLeftOf(begining, end) ? end : begining;
+
+    SweepEvent event;
+    event.segment = i;
+    event.isLeft = true;
+    event.position = segments[i].left;
+    events.push_back(event);
+    event.isLeft = false;
+    event.position = segments[i].right;
+    events.push_back(event);
+  }
+  std::sort(events.begin(), events.end());
 
-std::vector<int> Polygon::getSurfaceIndexes()
-{
-  std::vector<Point> points;
-  std::vector<int> sequence;
+  typedef std::set<unsigned int, SweepOrder> SweepLine;
+  SweepLine sweepLine((SweepOrder(&segments)));
+  std::vector<SweepLine::iterator> positions(count, sweepLine.end());
 
-  triangulation(&points, &sequence);
+  std::vector<unsigned int> candidates;
+  for (std::vector<SweepEvent>::iterator event = events.begin();
+       event != events.end();
+       event++)
+  {
+    candidates.clear();
+    SweepLine::iterator current;
 
-  return sequence;
-}
+    if (event->isLeft)
+    {
+      current = sweepLine.insert(event->segment).first;
+      positions[event->segment] = current;
 
-bool Polygon::triangulation(std::vector<Point> *points, std::vector<int> *sequence)
-{
-  /* allocate and initialize list of Vertices in polygon */
-  assert(numberOfVertices() >= 3);
+      if (current != sweepLine.begin())
+      {
+        SweepLine::iterator below = current;
+        below--;
+        candidates.push_back(*below);
+        candidates.push_back(*current);
+      }
+      SweepLine::iterator above = current;
+      above++;
+      if (above != sweepLine.end())
+      {
+        candidates.push_back(*current);
+        candidates.push_back(*above);
+      }
+    }
+    else
+    {
+      current = positions[event->segment];
+
+      SweepLine::iterator above = current;
+      above++;
+      if (current != sweepLine.begin() && above != sweepLine.end())
+      {
+        SweepLine::iterator below = current;
+        below--;
+        candidates.push_back(*below);
+        candidates.push_back(*above);
+      }
+      sweepLine.erase(current);
+    }
 
-  int n = vertices->size();
+    for (unsigned int i = 0; i < candidates.size(); i += 2)
+    {
+      if (edgesIntersect(candidates[i], candidates[i + 1]))
+      {
+        if (firstEdge != 0) *firstEdge = std::min(candidates[i], candidates[i + 1]);
+        if (secondEdge != 0) *secondEdge = std::max(candidates[i], candidates[i + 1]);
+        return false;
+      }
+    }
+  }
 
-  int *V = new int[n];
+  return true;
+}
 
-  /* we want a counter-clockwise polygon in V */
+bool Polygon::isClosed() const
+{
+  return numberOfVertices() >= 3;
+}
 
-  if ( 0.0 < signedArea() )
-    for (int v=0; v<n; v++) V[v] = v;
-  else
-    for(int v=0; v<n; v++) V[v] = (n-1)-v;
+std::string Polygon::toString() const
+{
+  std::string output = "Polygon(";
 
-  int nv = n;
+  for (unsigned int i = 0; i < numberOfVertices(); i++)
+  {
+    output += vertices[i].toString() + ", ";
+  }
+  return output + ").";
+}
 
-  /*  remove nv-2 Vertices, creating 1 triangle every time */
-  int count = 2*nv;   /* error detection */
+Polygon Polygon::convexHull() const
+{
+  std::vector<Point> sorted(vertices);
+  std::sort(sorted.begin(), sorted.end());
 
-  for(int m=0, v=nv-1; nv>2; )
+  Polygon hull;
+  if (sorted.size() < 3)
   {
-    /* if we loop, it is probably a non-simple polygon */
-    if (0 >= (count--))
+    for (unsigned int i = 0; i < sorted.size(); i++)
     {
-      //** Triangulate: ERROR - probable bad polygon!
-      return false;
+      hull.addVertex(sorted[i]);
     }
+    return hull;
+  }
 
-    /* three consecutive vertices in current polygon, <u,v,w> */
-    int u = v  ; if (nv <= u) u = 0;     /* previous */
-    v = u+1; if (nv <= v) v = 0;     /* new v    */
-    int w = v+1; if (nv <= w) w = 0;     /* next     */
-
-    if ( snip(u,v,w,nv,V) )
+  /* Lower chain from left to right, then upper chain back. */
+  std::vector<Point> chain(2*sorted.size());
+  int length = 0;
+  for (int i = 0; i < static_cast<int>(sorted.size()); i++)
+  {
+    while (length >= 2 && orientation(chain[length - 2], chain[length - 1], sorted[i]) <= 0)
     {
-      int a,b,c,s,t;
+      length--;
+    }
+    chain[length++] = sorted[i];
+  }
 
-      /* true names of the vertices */
-      a = V[u]; b = V[v]; c = V[w];
+  int lowerLength = length + 1;
+  for (int i = sorted.size() - 2; i >= 0; i--)
+  {
+    while (length >= lowerLength && orientation(chain[length - 2], chain[length - 1], sorted[i]) <= 0)
+    {
+      length--;
+    }
+    chain[length++] = sorted[i];
+  }
 
-      /* output Triangle */
-      points->push_back( *((*vertices)[a]) );
-      points->push_back( *((*vertices)[b]) );
-      points->push_back( *((*vertices)[c]) );
+  /* The first point closes the chain. */
+  for (int i = 0; i < length - 1; i++)
+  {
+    hull.addVertex(chain[i]);
+  }
 
-      sequence->push_back(a);
-      sequence->push_back(b);
-      sequence->push_back(c);
+  return hull;
+}
 
-      m++;
+std::vector<Point> Polygon::triangulate()
+{
+  Triangulator triangulator;
+  std::vector<int> sequence;
+  std::vector<Point> points;
 
-      /* remove v from remaining polygon */
-      for(s=v,t=v+1;t<nv;s++,t++) V[s] = V[t]; nv--;
+  triangulator.triangulate(*this, &sequence);
 
-      /* resest error detection counter */
-      count = 2*nv;
-    }
+  points.reserve(sequence.size());
+  for (std::vector<int>::iterator index = sequence.begin(); index != sequence.end(); index++)
+  {
+    points.push_back(vertices[*index]);
   }
 
-  delete V;
+  return points;
+}
+
+std::vector<int> Polygon::getSurfaceIndexes()
+{
+  Triangulator triangulator;
+  std::vector<int> sequence;
+
+  triangulator.triangulate(*this, &sequence);
 
-  return true;
-}
\ No newline at end of file
+  return sequence;
+}
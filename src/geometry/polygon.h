@@ -16,8 +16,10 @@
 #include <string>
 #include <list>
 
-class Point;
-class Vector;
+#include "point.h"
+#include "vector.h"
+#include "boundingbox.h"
+
 class LineSegment;
 class Line;
 
@@ -34,7 +36,17 @@ class Polygon
     ~Polygon();
 
   private:
-    std::vector<Point*> *vertices;
+    std::vector<Point> vertices;
+
+    /* Bounding box, grown with every added vertex. Computed
+       again only after a vertex on its border moves away. */
+    mutable BoundingBox box;
+    mutable bool boxIsValid;
+
+    /* Values computed on demand and kept until the vertices change. */
+    mutable double cachedSignedArea;
+    mutable bool signedAreaIsValid;
+    mutable std::vector<Vector> inwardNormals;
 
   public:
     Point vertex(unsigned int number) const;
@@ -50,9 +62,25 @@ class Polygon
     /** Works ONLY in 2D !!! */
     double area() const;
 
+    /**
+      Get the axis aligned bounding box of the polygon.
+     @remarks
+       The box is kept up to date as the vertices change,
+       so this is cheap.
+     */
+    BoundingBox aabb() const;
+
     /** Works ONLY in 2D !!! */
     Point centroid() const;
 
+    /**
+      Find out in which direction are the vertices ordered.
+     @remarks
+       Computed from the signed area which is cached.
+     @return True if the vertices go counter-clockwise in the XY plane.
+     */
+    bool isCounterclockwise() const;
+
     /**
       Get normal vector of a certain edge. The
       vector ALWAYS points inside the polygon.
@@ -95,6 +123,9 @@ class Polygon
 
     /**
       Substract distance from the polygon's borders.
+     @remarks
+       Edges that shrink to nothing are removed (see PolygonOffset).
+       When the whole polygon collapses, it is left without vertices.
      @param[in] distance Distance to be substracted
      */
     void substract(double distance);
@@ -106,46 +137,58 @@ class Polygon
      */
     void substractEdge(int edgeNumber, double distance);
 
+    /** @see PolygonSplitter to split many polygons without allocations. */
     std::list<Polygon*> split(Line const& splitLine);
 
+    /** Can the split line reach any of the edges? */
+    bool mayIntersect(Line const& line) const;
+
     bool encloses2D(Point const& point) const;
 
-    bool isNonSelfIntersecting();
+    /**
+      Find out if any two edges of the polygon touch or cross.
+     @remarks
+       Shamos-Hoey sweep, O(n log n). Neighbouring edges may
+       only share their common vertex.
+     @param[out] firstEdge  If not 0, gets the number of one
+                            of the offending edges.
+     @param[out] secondEdge If not 0, gets the number of the other one.
+     @return True if the polygon is simple.
+     */
+    bool isNonSelfIntersecting(unsigned int* firstEdge = 0, unsigned int* secondEdge = 0) const;
     bool isClosed() const;
 
+    /** @see Triangulator to triangulate many polygons without allocations. */
     std::vector<Point> triangulate();
     std::vector<int> getSurfaceIndexes();
 
+    /**
+      Convex hull of the vertices.
+     @remarks
+       Monotone chain, O(n log n). Collinear vertices are left out.
+     @return Counter-clockwise hull starting at the lowest vertex.
+     */
+    Polygon convexHull() const;
+
     bool isSubAreaOf(Polygon const& biggerPolygon);
     bool operator==(Polygon const& second);
 
     std::string toString() const;
   private:
-    void initialize();
-    void freeVertices();
-
     double signedArea() const;
 
-    /* Helper functions for split polygon */
-    bool isVertexIntersection(Point vertex, std::list<Point> intersections);
-    bool areVerticesInPair(Point first, Point second, std::list<Point> intersections);
+    /** Drop cached values after the vertices have changed. */
+    void invalidateCache();
 
-  private:
-    /* Polygon triangulation */
-    /* Taken from:
-     * http://www.flipcode.com/archives/Efficient_Polygon_Triangulation.shtml */ 
-    // triangulate a contour/polygon, places results in STL vector
-    // as series of triangles.
-    bool triangulation(std::vector<Point> *points, std::vector<int> *sequence);
-
-    // decide if point Px/Py is inside triangle defined by
-    // (Ax,Ay) (Bx,By) (Cx,Cy)
-    bool isInsideTriangle(double Ax, double Ay,
-                        double Bx, double By,
-                        double Cx, double Cy,
-                        double Px, double Py);
-
-    bool snip(int u,int v,int w,int n,int *V);
+    /** Vertex is about to move or disappear, the box may shrink. */
+    void vertexLeavesBox(Point const& vertex);
+
+    void computeInwardNormals() const;
+    bool isInPlaneXY() const;
+    Vector edgeNormalByRay(unsigned int edgeNumber) const;
+
+    /** Do two edges touch or cross? Used by the simplicity test. */
+    bool edgesIntersect(unsigned int first, unsigned int second) const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,209 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/polygonoffset.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see geometry/polygonoffset.h
+ *
+ */
+
+#include "polygonoffset.h"
+#include "polygon.h"
+#include "line.h"
+#include "units.h"
+#include "../debug.h"
+
+#include <algorithm>
+#include <cmath>
+
+PolygonOffset::PolygonOffset()
+{
+  initialize();
+}
+
+PolygonOffset::~PolygonOffset()
+{
+  freeMemory();
+}
+
+void PolygonOffset::initialize()
+{
+  edges = new std::vector<Edge>;
+  events = new std::vector<Event>;
+}
+
+void PolygonOffset::freeMemory()
+{
+  delete edges;
+  delete events;
+}
+
+bool PolygonOffset::Event::operator<(Event const& another) const
+{
+  if (time != another.time)
+  {
+    return time > another.time;
+  }
+  return edge > another.edge;
+}
+
+bool PolygonOffset::offset(Polygon* polygon, std::vector<double> const& distances)
+{
+  int numberOfEdges = polygon->numberOfVertices();
+  assert(distances.size() == static_cast<unsigned int>(numberOfEdges));
+
+  if (numberOfEdges < 3)
+  {
+    return false;
+  }
+
+  edges->resize(numberOfEdges);
+  events->clear();
+
+  for (int i = 0; i < numberOfEdges; i++)
+  {
+    Edge& current = (*edges)[i];
+    current.begining = polygon->vertex(i);
+    current.end = polygon->vertex((i + 1) % numberOfEdges);
+    current.normal = polygon->edgeNormal(i);
+    current.normal.normalize();
+    current.distance = distances[i];
+    current.previous = (i - 1) < 0 ? numberOfEdges - 1 : i - 1;
+    current.next = (i + 1) % numberOfEdges;
+    current.version = 0;
+    current.removed = false;
+  }
+
+  for (int i = 0; i < numberOfEdges; i++)
+  {
+    Edge& current = (*edges)[i];
+    current.origin = current.begining;
+    current.velocity = vertexVelocity((*edges)[current.previous], current);
+  }
+
+  for (int i = 0; i < numberOfEdges; i++)
+  {
+    scheduleCollapse(i, 0);
+  }
+
+  int remainingEdges = numberOfEdges;
+  while (!events->empty())
+  {
+    std::pop_heap(events->begin(), events->end());
+    Event event = events->back();
+    events->pop_back();
+
+    Edge& collapsed = (*edges)[event.edge];
+    if (collapsed.removed || collapsed.version != event.version)
+    {
+      /* Outdated event */
+      continue;
+    }
+
+    collapsed.removed = true;
+    remainingEdges--;
+    if (remainingEdges < 3)
+    {
+      return false;
+    }
+
+    /* Both vertices of the edge meet in one point. */
+    Point meetingPoint = collapsed.origin + collapsed.velocity*event.time;
+
+    Edge& previous = (*edges)[collapsed.previous];
+    Edge& next = (*edges)[collapsed.next];
+    previous.next = collapsed.next;
+    next.previous = collapsed.previous;
+
+    next.velocity = vertexVelocity(previous, next);
+    next.origin = meetingPoint + next.velocity*(-event.time);
+
+    previous.version++;
+    next.version++;
+    scheduleCollapse(collapsed.previous, event.time);
+    scheduleCollapse(collapsed.next, event.time);
+  }
+
+  /* Vertices of the remaining edges. */
+  int first = 0;
+  while ((*edges)[first].removed)
+  {
+    first++;
+  }
+
+  Polygon result;
+  int current = first;
+  do
+  {
+    Edge const& edge = (*edges)[current];
+    result.addVertex(finalVertex((*edges)[edge.previous], edge));
+    current = edge.next;
+  } while (current != first);
+
+  *polygon = result;
+  return true;
+}
+
+Vector PolygonOffset::vertexVelocity(Edge const& previous, Edge const& next) const
+{
+  /* Velocity v of the vertex moves it by the distance of each edge
+     along that edge's normal: v.n1 = d1, v.n2 = d2 */
+  double determinant = previous.normal.x()*next.normal.y() - previous.normal.y()*next.normal.x();
+  if (std::abs(determinant) < libcity::EPSILON)
+  {
+    return next.normal*std::max(previous.distance, next.distance);
+  }
+
+  return Vector((previous.distance*next.normal.y() - next.distance*previous.normal.y()) / determinant,
+                (previous.normal.x()*next.distance - next.normal.x()*previous.distance) / determinant);
+}
+
+void PolygonOffset::scheduleCollapse(int edge, double now)
+{
+  Edge const& current = (*edges)[edge];
+  Edge const& next = (*edges)[current.next];
+
+  /* Length of the edge measured along its original direction
+     changes linearly with time. */
+  Vector direction(current.begining, current.end);
+  double length = Vector(current.origin, next.origin).dotProduct(direction);
+  Vector relativeVelocity(next.velocity.x() - current.velocity.x(),
+                          next.velocity.y() - current.velocity.y());
+  double shrinking = relativeVelocity.dotProduct(direction);
+  if (shrinking >= 0)
+  {
+    return;
+  }
+
+  double time = std::max(-length / shrinking, now);
+  if (time > 1)
+  {
+    return;
+  }
+
+  Event event;
+  event.time = time;
+  event.edge = edge;
+  event.version = current.version;
+
+  events->push_back(event);
+  std::push_heap(events->begin(), events->end());
+}
+
+Point PolygonOffset::finalVertex(Edge const& previous, Edge const& next) const
+{
+  Line previousEdge(previous.end + previous.normal*previous.distance,
+                    previous.begining + previous.normal*previous.distance);
+  Line nextEdge(next.begining + next.normal*next.distance,
+                next.end + next.normal*next.distance);
+
+  Point vertex;
+  if (nextEdge.intersection2D(previousEdge, &vertex) == Line::PARALLEL)
+  {
+    vertex = next.begining + next.normal*std::max(previous.distance, next.distance);
+  }
+
+  return vertex;
+}
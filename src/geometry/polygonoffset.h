@@ -0,0 +1,100 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/polygonoffset.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Offsetting of polygon's edges by different distances.
+ *
+ * Edges are moved inwards as a wavefront. Edge i moves by
+ * distances[i]*t as the time t goes from 0 to 1 and each
+ * vertex follows the (weighted) bisector of its edges. When
+ * an edge shrinks to zero length before t reaches 1, it is
+ * removed and its neighbours are joined. Edge events are
+ * processed from a priority queue in O(n log n).
+ *
+ * Split events (a reflex vertex hitting an edge on the other
+ * side) are not handled, the result can still intersect
+ * itself in that case.
+ *
+ */
+
+#ifndef _POLYGONOFFSET_H_
+#define _POLYGONOFFSET_H_
+
+#include <vector>
+
+#include "point.h"
+#include "vector.h"
+
+class Polygon;
+
+class PolygonOffset
+{
+  public:
+    PolygonOffset();
+    ~PolygonOffset();
+
+    /**
+      Move the edges of the polygon inwards.
+     @remarks
+       Vertices of edges that are not removed are the intersections
+       of the offset lines, the same as with Polygon::substract.
+       The working memory is kept between calls, so one instance
+       should be reused for a whole batch of polygons.
+     @param[in,out] polygon   Polygon to be offset. Left untouched
+                              when it collapses.
+     @param[in]     distances Distance for each edge (edge i goes from
+                              vertex i to vertex i + 1). Negative
+                              distances move the edge outwards.
+     @return False if the whole polygon collapsed.
+     */
+    bool offset(Polygon* polygon, std::vector<double> const& distances);
+
+  private: /* Copying not allowed */
+    PolygonOffset(PolygonOffset const& source);
+    PolygonOffset& operator=(PolygonOffset const& source);
+
+  private:
+    struct Edge
+    {
+      Point begining;
+      Point end;
+      Vector normal; /**< Unit inward normal */
+      double distance;
+
+      /** Neighbours in the current wavefront. */
+      int previous;
+      int next;
+
+      /** Trajectory of the starting vertex is origin + velocity*t. */
+      Point origin;
+      Vector velocity;
+
+      unsigned int version; /**< Invalidates queued events */
+      bool removed;
+    };
+
+    struct Event
+    {
+      double time;
+      int edge;
+      unsigned int version;
+
+      /** Reversed, so the priority queue returns the earliest event. */
+      bool operator<(Event const& another) const;
+    };
+
+    std::vector<Edge>* edges;
+    std::vector<Event>* events;
+
+    Vector vertexVelocity(Edge const& previous, Edge const& next) const;
+    void scheduleCollapse(int edge, double now);
+    Point finalVertex(Edge const& previous, Edge const& next) const;
+
+    void initialize();
+    void freeMemory();
+};
+
+#endif
@@ -0,0 +1,188 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/polygonsplitter.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see geometry/polygonsplitter.h
+ *
+ */
+
+#include "polygonsplitter.h"
+#include "polygon.h"
+#include "line.h"
+#include "linesegment.h"
+#include "../debug.h"
+
+#include <algorithm>
+
+PolygonSplitter::PolygonSplitter()
+{
+  initialize();
+}
+
+PolygonSplitter::~PolygonSplitter()
+{
+  freeMemory();
+}
+
+void PolygonSplitter::initialize()
+{
+  vertices = new std::vector<Point>;
+  intersections = new std::vector<Point>;
+  workspace = new std::vector<Polygon>;
+  stack = new std::vector<unsigned int>;
+  finished = new std::vector<unsigned int>;
+}
+
+void PolygonSplitter::freeMemory()
+{
+  delete vertices;
+  delete intersections;
+  delete workspace;
+  delete stack;
+  delete finished;
+}
+
+unsigned int PolygonSplitter::split(Polygon const& polygon, Line const& splitLine, std::vector<Polygon>* pieces)
+{
+  if (!polygon.mayIntersect(splitLine))
+  /* The line goes around */
+  {
+    return store(polygon, 0, pieces);
+  }
+
+  vertices->clear();
+  intersections->clear();
+
+  LineSegment currentEdge;
+  Point intersection;
+  for (unsigned int i = 0; i < polygon.numberOfVertices(); i++)
+  {
+    currentEdge = polygon.edge(i);
+    vertices->push_back(polygon.vertex(i));
+
+    if (currentEdge.intersection2D(splitLine, &intersection) == Line::INTERSECTING)
+    {
+      if (intersection != currentEdge.begining() &&
+          intersection != currentEdge.end())
+      {
+        vertices->push_back(intersection);
+      }
+      intersections->push_back(intersection);
+    }
+  }
+
+  std::sort(intersections->begin(), intersections->end());
+  intersections->erase(std::unique(intersections->begin(), intersections->end()),
+                       intersections->end());
+
+  /* Split line was out or was just touching a vertex */
+  if (intersections->size() <= 1)
+  {
+    return store(polygon, 0, pieces);
+  }
+
+  unsigned int used = 0;
+  stack->clear();
+  finished->clear();
+  stack->push_back(openPolygon(&used));
+
+  for (std::vector<Point>::iterator vertex = vertices->begin();
+       vertex != vertices->end();
+       vertex++)
+  {
+    (*workspace)[stack->back()].addVertex(*vertex);
+
+    int index = intersectionIndex(*vertex);
+    if (index < 0)
+    {
+      continue;
+    }
+
+    /* Intersections pair up along the line: 0-1, 2-3, ... */
+    unsigned int pair = (index % 2) ? index - 1 : index + 1;
+    Polygon const& top = (*workspace)[stack->back()];
+    if (pair < intersections->size() && (*intersections)[pair] == top.vertex(0))
+    {
+      if (top.isClosed())
+      {
+        finished->push_back(stack->back());
+      }
+
+      stack->pop_back();
+      if (stack->empty())
+      {
+        stack->push_back(openPolygon(&used));
+      }
+    }
+    else
+    {
+      stack->push_back(openPolygon(&used));
+    }
+    (*workspace)[stack->back()].addVertex(*vertex);
+  }
+
+  if ((*workspace)[stack->back()].isClosed())
+  {
+    finished->push_back(stack->back());
+  }
+
+  unsigned int count = 0;
+  for (std::vector<unsigned int>::iterator piece = finished->begin();
+       piece != finished->end();
+       piece++)
+  {
+    count = store((*workspace)[*piece], count, pieces);
+  }
+
+  return count;
+}
+
+int PolygonSplitter::intersectionIndex(Point const& point) const
+{
+  int candidate = std::lower_bound(intersections->begin(), intersections->end(), point) -
+                  intersections->begin();
+
+  /* Equal points may be sorted on either side of the point. */
+  for (int i = std::max(candidate - 1, 0);
+       i <= candidate + 1 && i < static_cast<int>(intersections->size());
+       i++)
+  {
+    if ((*intersections)[i] == point)
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+unsigned int PolygonSplitter::openPolygon(unsigned int* used)
+{
+  if (*used == workspace->size())
+  {
+    workspace->push_back(Polygon());
+  }
+  else
+  {
+    (*workspace)[*used].clear();
+  }
+
+  return (*used)++;
+}
+
+unsigned int PolygonSplitter::store(Polygon const& piece, unsigned int count, std::vector<Polygon>* pieces) const
+{
+  if (count < pieces->size())
+  {
+    (*pieces)[count] = piece;
+  }
+  else
+  {
+    pieces->push_back(piece);
+  }
+
+  return count + 1;
+}
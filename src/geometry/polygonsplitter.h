@@ -0,0 +1,79 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/polygonsplitter.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Splitting of polygons by lines into reused buffers.
+ *
+ * Vertices and intersections with the line are walked once,
+ * intersections are sorted along the line and each vertex
+ * finds its pair by binary search, so splitting takes
+ * O(n log k) for k intersections. All the working memory
+ * is kept between calls.
+ *
+ */
+
+#ifndef _POLYGONSPLITTER_H_
+#define _POLYGONSPLITTER_H_
+
+#include <vector>
+
+#include "point.h"
+
+class Polygon;
+class Line;
+
+class PolygonSplitter
+{
+  public:
+    PolygonSplitter();
+    ~PolygonSplitter();
+
+    /**
+      Split polygon by a line.
+     @remarks
+       Pieces are written to the beginning of the buffer, polygons
+       already stored there are reused and the buffer only grows.
+       Elements after the returned count are left as they were.
+     @param[in]  polygon    Polygon to be split.
+     @param[in]  splitLine  Line going through the polygon.
+     @param[out] pieces     Buffer for the resulting polygons.
+     @return Number of pieces. A copy of the polygon is the only
+             piece when the line doesn't cut it.
+     */
+    unsigned int split(Polygon const& polygon, Line const& splitLine, std::vector<Polygon>* pieces);
+
+  private: /* Copying not allowed */
+    PolygonSplitter(PolygonSplitter const& source);
+    PolygonSplitter& operator=(PolygonSplitter const& source);
+
+  private:
+    /** Vertices of the polygon with intersections inserted. */
+    std::vector<Point>* vertices;
+
+    /** Intersections sorted along the line, without duplicates. */
+    std::vector<Point>* intersections;
+
+    /** Polygons being built and the stack of the open ones. */
+    std::vector<Polygon>* workspace;
+    std::vector<unsigned int>* stack;
+
+    /** Workspace polygons in the order they were finished. */
+    std::vector<unsigned int>* finished;
+
+    /**
+      Position of the point among the intersections.
+     @return Index into intersections or -1.
+     */
+    int intersectionIndex(Point const& point) const;
+
+    unsigned int openPolygon(unsigned int* used);
+    unsigned int store(Polygon const& piece, unsigned int count, std::vector<Polygon>* pieces) const;
+
+    void initialize();
+    void freeMemory();
+};
+
+#endif
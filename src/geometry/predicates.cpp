@@ -0,0 +1,223 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/predicates.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see geometry/predicates.h
+ *
+ */
+
+#include "predicates.h"
+
+namespace
+{
+  /* Numbers are represented as unevaluated sums of doubles
+     (expansions) with non-overlapping bits, smallest magnitude
+     first. Zero components are dropped, an expansion of
+     zero length is zero. */
+
+  /* 2^27 + 1, splits a double into two halves */
+  const double SPLITTER = 134217729.0;
+
+  /* The compiler must not keep these in extended precision or
+     fuse them, the error terms would be wrong. x86-64 uses SSE
+     and doesn't contract without -ffp-contract=fast. */
+
+  inline void twoSum(double a, double b, double* sum, double* error)
+  {
+    double x = a + b;
+    double bVirtual = x - a;
+    double aVirtual = x - bVirtual;
+    *sum = x;
+    *error = (a - aVirtual) + (b - bVirtual);
+  }
+
+  inline void twoDiff(double a, double b, double* difference, double* error)
+  {
+    twoSum(a, -b, difference, error);
+  }
+
+  inline void split(double a, double* high, double* low)
+  {
+    double c = SPLITTER*a;
+    double big = c - a;
+    *high = c - big;
+    *low = a - *high;
+  }
+
+  inline void twoProduct(double a, double b, double* product, double* error)
+  {
+    double x = a*b;
+    double aHigh, aLow, bHigh, bLow;
+    split(a, &aHigh, &aLow);
+    split(b, &bHigh, &bLow);
+    double error1 = x - (aHigh*bHigh);
+    double error2 = error1 - (aLow*bHigh);
+    double error3 = error2 - (aHigh*bLow);
+    *product = x;
+    *error = (aLow*bLow) - error3;
+  }
+
+  /** h = e + b, returns length of h (at most elength + 1). */
+  int grow(int elength, double const* e, double b, double* h)
+  {
+    int hlength = 0;
+    double q = b, error;
+    for (int i = 0; i < elength; i++)
+    {
+      twoSum(q, e[i], &q, &error);
+      if (error != 0)
+      {
+        h[hlength++] = error;
+      }
+    }
+    if (q != 0)
+    {
+      h[hlength++] = q;
+    }
+    return hlength;
+  }
+
+  /** h = e + f, h must not be e. */
+  int sum(int elength, double const* e, int flength, double const* f, double* h)
+  {
+    int hlength = elength;
+    for (int i = 0; i < elength; i++)
+    {
+      h[i] = e[i];
+    }
+    for (int i = 0; i < flength; i++)
+    {
+      /* grow() may work in place, output never overtakes input */
+      hlength = grow(hlength, h, f[i], h);
+    }
+    return hlength;
+  }
+
+  /** h = e * b, returns length of h (at most 2*elength). */
+  int scale(int elength, double const* e, double b, double* h)
+  {
+    int hlength = 0;
+    for (int i = 0; i < elength; i++)
+    {
+      double product, error;
+      twoProduct(e[i], b, &product, &error);
+      hlength = grow(hlength, h, error, h);
+      hlength = grow(hlength, h, product, h);
+    }
+    return hlength;
+  }
+
+  /** h = e * f, buffer must hold 2*elength doubles. */
+  int product(int elength, double const* e, int flength, double const* f, double* h, double* buffer)
+  {
+    int hlength = 0;
+    for (int i = 0; i < flength; i++)
+    {
+      int blength = scale(elength, e, f[i], buffer);
+      for (int j = 0; j < blength; j++)
+      {
+        hlength = grow(hlength, h, buffer[j], h);
+      }
+    }
+    return hlength;
+  }
+
+  void negate(int elength, double* e)
+  {
+    for (int i = 0; i < elength; i++)
+    {
+      e[i] = -e[i];
+    }
+  }
+
+  /** Largest component carries the sign. */
+  double estimate(int elength, double const* e)
+  {
+    return elength > 0 ? e[elength - 1] : 0.0;
+  }
+
+  /** a - b exactly, returns length. */
+  int difference(double a, double b, double* h)
+  {
+    double head, tail;
+    twoDiff(a, b, &head, &tail);
+    int hlength = 0;
+    if (tail != 0) h[hlength++] = tail;
+    if (head != 0) h[hlength++] = head;
+    return hlength;
+  }
+
+  /* Largest expansions needed by incircle */
+  const int DIFFERENCE_SIZE = 2;
+  const int SQUARE_SIZE = 2*DIFFERENCE_SIZE*DIFFERENCE_SIZE;
+  const int LIFT_SIZE = 2*SQUARE_SIZE;
+  const int CROSS_SIZE = 2*SQUARE_SIZE;
+  const int TERM_SIZE = 2*LIFT_SIZE*CROSS_SIZE;
+
+  /** h = a*d - b*c, returns length. */
+  int cross(int alength, double const* a, int blength, double const* b,
+            int clength, double const* c, int dlength, double const* d, double* h)
+  {
+    double left[SQUARE_SIZE], right[SQUARE_SIZE], buffer[2*DIFFERENCE_SIZE];
+    int leftLength  = product(alength, a, dlength, d, left, buffer);
+    int rightLength = product(blength, b, clength, c, right, buffer);
+    negate(rightLength, right);
+    return sum(leftLength, left, rightLength, right, h);
+  }
+
+  /** h = x*x + y*y, returns length. */
+  int lift(int xlength, double const* x, int ylength, double const* y, double* h)
+  {
+    double xx[SQUARE_SIZE], yy[SQUARE_SIZE], buffer[2*DIFFERENCE_SIZE];
+    int xxLength = product(xlength, x, xlength, x, xx, buffer);
+    int yyLength = product(ylength, y, ylength, y, yy, buffer);
+    return sum(xxLength, xx, yyLength, yy, h);
+  }
+}
+
+double libcity::orient2dExact(double ax, double ay, double bx, double by, double cx, double cy)
+{
+  double acx[DIFFERENCE_SIZE], acy[DIFFERENCE_SIZE], bcx[DIFFERENCE_SIZE], bcy[DIFFERENCE_SIZE];
+  int acxLength = difference(ax, cx, acx), acyLength = difference(ay, cy, acy),
+      bcxLength = difference(bx, cx, bcx), bcyLength = difference(by, cy, bcy);
+
+  double determinant[CROSS_SIZE];
+  int length = cross(acxLength, acx, acyLength, acy, bcxLength, bcx, bcyLength, bcy, determinant);
+
+  return estimate(length, determinant);
+}
+
+double libcity::incircleExact(double ax, double ay, double bx, double by,
+                              double cx, double cy, double dx, double dy)
+{
+  double adx[DIFFERENCE_SIZE], ady[DIFFERENCE_SIZE],
+         bdx[DIFFERENCE_SIZE], bdy[DIFFERENCE_SIZE],
+         cdx[DIFFERENCE_SIZE], cdy[DIFFERENCE_SIZE];
+  int adxLength = difference(ax, dx, adx), adyLength = difference(ay, dy, ady),
+      bdxLength = difference(bx, dx, bdx), bdyLength = difference(by, dy, bdy),
+      cdxLength = difference(cx, dx, cdx), cdyLength = difference(cy, dy, cdy);
+
+  double alift[LIFT_SIZE], blift[LIFT_SIZE], clift[LIFT_SIZE];
+  int aliftLength = lift(adxLength, adx, adyLength, ady, alift),
+      bliftLength = lift(bdxLength, bdx, bdyLength, bdy, blift),
+      cliftLength = lift(cdxLength, cdx, cdyLength, cdy, clift);
+
+  double bc[CROSS_SIZE], ca[CROSS_SIZE], ab[CROSS_SIZE];
+  int bcLength = cross(bdxLength, bdx, bdyLength, bdy, cdxLength, cdx, cdyLength, cdy, bc),
+      caLength = cross(cdxLength, cdx, cdyLength, cdy, adxLength, adx, adyLength, ady, ca),
+      abLength = cross(adxLength, adx, adyLength, ady, bdxLength, bdx, bdyLength, bdy, ab);
+
+  double aterm[TERM_SIZE], bterm[TERM_SIZE], cterm[TERM_SIZE], buffer[2*LIFT_SIZE];
+  int atermLength = product(aliftLength, alift, bcLength, bc, aterm, buffer),
+      btermLength = product(bliftLength, blift, caLength, ca, bterm, buffer),
+      ctermLength = product(cliftLength, clift, abLength, ab, cterm, buffer);
+
+  double abterm[2*TERM_SIZE], determinant[3*TERM_SIZE];
+  int abtermLength = sum(atermLength, aterm, btermLength, bterm, abterm);
+  int length = sum(abtermLength, abterm, ctermLength, cterm, determinant);
+
+  return estimate(length, determinant);
+}
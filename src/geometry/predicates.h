@@ -0,0 +1,121 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/predicates.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Orientation and incircle tests with exact sign.
+ *
+ * The determinant is first evaluated in plain floating point
+ * together with a bound of its rounding error (J. R. Shewchuk,
+ * Adaptive Precision Floating-Point Arithmetic and Fast Robust
+ * Geometric Predicates, 1997). Only when the result is smaller
+ * than the bound, it's recomputed exactly with expansion
+ * arithmetic. That happens only for (nearly) degenerate input.
+ *
+ * The sign of the result is always correct. The magnitude is
+ * only approximate, use these for decisions, not measurements.
+ *
+ */
+
+#ifndef _PREDICATES_H_
+#define _PREDICATES_H_
+
+#include <cmath>
+
+namespace libcity
+{
+  /** Exact evaluation, used when the filter fails. */
+  double orient2dExact(double ax, double ay, double bx, double by, double cx, double cy);
+  double incircleExact(double ax, double ay, double bx, double by,
+                       double cx, double cy, double dx, double dy);
+
+  /* Error bounds of the floating point evaluation */
+  const double PREDICATE_EPSILON = 1.1102230246251565e-16; /* 2^-53 */
+  const double ORIENT2D_ERROR_BOUND = (3.0 + 16.0*PREDICATE_EPSILON)*PREDICATE_EPSILON;
+  const double INCIRCLE_ERROR_BOUND = (10.0 + 96.0*PREDICATE_EPSILON)*PREDICATE_EPSILON;
+
+  /**
+    Orientation of point c relative to the directed line
+    going from a to b.
+   @return Positive when c lies left of the line, negative
+           when it lies right and exactly zero when the points
+           are collinear.
+   */
+  inline double orient2dRobust(double ax, double ay,
+                               double bx, double by,
+                               double cx, double cy)
+  {
+    double left  = (ax - cx)*(by - cy),
+           right = (ay - cy)*(bx - cx),
+           determinant = left - right;
+
+    double bound = ORIENT2D_ERROR_BOUND*(std::abs(left) + std::abs(right));
+    if (determinant > bound || -determinant > bound)
+    {
+      return determinant;
+    }
+
+    return orient2dExact(ax, ay, bx, by, cx, cy);
+  }
+
+  /**
+    Is the direction from center to a before the direction
+    from center to b when going counter-clockwise from the
+    positive x axis? Orders points around the center exactly.
+   */
+  inline bool isCounterclockwiseBefore(double centerX, double centerY,
+                                       double ax, double ay,
+                                       double bx, double by)
+  {
+    /* Directions from 0 (inclusive) to 180 degrees come first. */
+    bool aIsLower = ay < centerY || (ay == centerY && ax < centerX);
+    bool bIsLower = by < centerY || (by == centerY && bx < centerX);
+    if (aIsLower != bIsLower)
+    {
+      return bIsLower;
+    }
+
+    return orient2dRobust(centerX, centerY, ax, ay, bx, by) > 0;
+  }
+
+  /**
+    Position of point d relative to the circle going
+    through a, b and c (counter-clockwise).
+   @return Positive when d lies inside the circle, negative
+           when outside and exactly zero when on it.
+   */
+  inline double incircleRobust(double ax, double ay, double bx, double by,
+                               double cx, double cy, double dx, double dy)
+  {
+    double adx = ax - dx, ady = ay - dy,
+           bdx = bx - dx, bdy = by - dy,
+           cdx = cx - dx, cdy = cy - dy;
+
+    double bdxcdy = bdx*cdy, cdxbdy = cdx*bdy,
+           cdxady = cdx*ady, adxcdy = adx*cdy,
+           adxbdy = adx*bdy, bdxady = bdx*ady;
+
+    double alift = adx*adx + ady*ady,
+           blift = bdx*bdx + bdy*bdy,
+           clift = cdx*cdx + cdy*cdy;
+
+    double determinant = alift*(bdxcdy - cdxbdy) +
+                         blift*(cdxady - adxcdy) +
+                         clift*(adxbdy - bdxady);
+
+    double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy))*alift +
+                       (std::abs(cdxady) + std::abs(adxcdy))*blift +
+                       (std::abs(adxbdy) + std::abs(bdxady))*clift;
+    double bound = INCIRCLE_ERROR_BOUND*permanent;
+    if (determinant > bound || -determinant > bound)
+    {
+      return determinant;
+    }
+
+    return incircleExact(ax, ay, bx, by, cx, cy, dx, dy);
+  }
+}
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/preparedpolygon.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see geometry/preparedpolygon.h
+ *
+ */
+
+#include "preparedpolygon.h"
+#include "polygon.h"
+#include "linesegment.h"
+#include "kernel.h"
+#include "units.h"
+#include "../debug.h"
+
+#include <cmath>
+
+PreparedPolygon::PreparedPolygon(Polygon const& polygon)
+{
+  initialize(polygon);
+}
+
+void PreparedPolygon::initialize(Polygon const& polygon)
+{
+  edges = new std::vector<Edge>;
+
+  unsigned int count = polygon.numberOfVertices();
+  edges->reserve(count);
+
+  for (unsigned int i = 0; i < count; i++)
+  {
+    Point current = polygon.vertex(i),
+          next    = polygon.vertex((i + 1) % count);
+
+    Edge edge;
+    edge.begining = current;
+    edge.beginingX = current.x();
+    edge.beginingY = current.y();
+    edge.endX = next.x();
+    edge.endY = next.y();
+
+    /* Same expression as in Polygon::encloses2D(). Edges that
+       are horizontal are never crossed, so inf or NaN is fine. */
+    edge.inverseSlope = (next.x() - current.x()) / (next.y() - current.y());
+
+    if (std::abs(current.x() - next.x()) > libcity::COORDINATES_EPSILON)
+    {
+      edge.parameter = PARAMETER_X;
+    }
+    else if (std::abs(current.y() - next.y()) > libcity::COORDINATES_EPSILON)
+    {
+      edge.parameter = PARAMETER_Y;
+    }
+    else
+    {
+      edge.parameter = DEGENERATE;
+    }
+
+    edge.box = BoundingBox(current, next);
+    edge.box.expand(LineSegment::BOX_TOLERANCE);
+    box.include(edge.box);
+
+    edges->push_back(edge);
+  }
+}
+
+PreparedPolygon::~PreparedPolygon()
+{
+  freeMemory();
+}
+
+void PreparedPolygon::freeMemory()
+{
+  delete edges;
+}
+
+bool PreparedPolygon::crossingParity(double x, double y) const
+{
+  bool isInside = false;
+
+  std::vector<Edge>::const_iterator edge = edges->begin(),
+                                    last = edges->end();
+  for (; edge != last; edge++)
+  {
+    bool crossing = ((edge->beginingY > y) != (edge->endY > y)) &
+                    (x < edge->inverseSlope * (y - edge->beginingY) + edge->beginingX);
+    isInside ^= crossing;
+  }
+
+  return isInside;
+}
+
+bool PreparedPolygon::isOnBorder(Point const& point) const
+{
+  for (std::vector<Edge>::const_iterator edge = edges->begin();
+       edge != edges->end();
+       edge++)
+  {
+    if (!edge->box.contains(point))
+    {
+      continue;
+    }
+
+    /* Same as LineSegment::hasPoint2D() */
+    double lineTest = libcity::orient2d(edge->beginingX, edge->beginingY,
+                                        edge->endX, edge->endY,
+                                        point.x(), point.y());
+    if (std::abs(lineTest) >= libcity::COORDINATES_EPSILON)
+    {
+      continue;
+    }
+
+    double t = 0.0;
+    switch (edge->parameter)
+    {
+      case PARAMETER_X:
+        t = (point.x() - edge->beginingX) / (edge->endX - edge->beginingX);
+        break;
+      case PARAMETER_Y:
+        t = (point.y() - edge->beginingY) / (edge->endY - edge->beginingY);
+        break;
+      case DEGENERATE:
+        if (edge->begining == point)
+        {
+          return true;
+        }
+        continue;
+    }
+
+    if (t >= 0 && t <= 1)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool PreparedPolygon::encloses2D(Point const& point) const
+{
+  if (!box.contains(point))
+  /* Too far from all the edges and crossings sum up to even number. */
+  {
+    return false;
+  }
+
+  return crossingParity(point.x(), point.y()) || isOnBorder(point);
+}
+
+unsigned int PreparedPolygon::enclosesBatch(std::vector<Point> const& points, std::vector<bool>* results) const
+{
+  unsigned int count = points.size();
+
+  std::vector<double> x(count), y(count);
+  std::vector<unsigned char> parity(count, 0);
+  for (unsigned int i = 0; i < count; i++)
+  {
+    x[i] = points[i].x();
+    y[i] = points[i].y();
+  }
+
+  /* Edges in the outer loop, so the inner one runs over
+     plain arrays and can be vectorized. */
+  for (std::vector<Edge>::const_iterator edge = edges->begin();
+       edge != edges->end();
+       edge++)
+  {
+    double beginingX = edge->beginingX, beginingY = edge->beginingY,
+           endY = edge->endY, inverseSlope = edge->inverseSlope;
+    for (unsigned int i = 0; i < count; i++)
+    {
+      parity[i] ^= ((beginingY > y[i]) != (endY > y[i])) &
+                   (x[i] < inverseSlope * (y[i] - beginingY) + beginingX);
+    }
+  }
+
+  unsigned int inside = 0;
+  results->assign(count, false);
+  for (unsigned int i = 0; i < count; i++)
+  {
+    if (parity[i] || (box.contains(points[i]) && isOnBorder(points[i])))
+    {
+      (*results)[i] = true;
+      inside++;
+    }
+  }
+
+  return inside;
+}
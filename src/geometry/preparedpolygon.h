@@ -0,0 +1,96 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/preparedpolygon.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Polygon prepared for repeated point-in-polygon tests.
+ *
+ * Bounding box and edge table (end points, inverse slope and
+ * the coordinate used to test whether a point lies on the edge)
+ * are computed once. Result of the test is exactly the same as
+ * the one of Polygon::encloses2D().
+ *
+ * Crossings are counted over all edges in a branchless loop
+ * first. The more expensive test whether the point lies on the
+ * border is only done when the count says the point is outside,
+ * and only for the edges whose box is close enough to the point.
+ *
+ */
+
+#ifndef _PREPAREDPOLYGON_H_
+#define _PREPAREDPOLYGON_H_
+
+#include <vector>
+
+#include "boundingbox.h"
+#include "point.h"
+
+class Polygon;
+
+class PreparedPolygon
+{
+  public:
+    PreparedPolygon(Polygon const& polygon);
+    ~PreparedPolygon();
+
+    BoundingBox boundingBox() const;
+    unsigned int numberOfEdges() const;
+
+    /**
+      Test a single point.
+     @remarks
+       Points on the border are inside.
+     @param[in] point Tested point.
+     */
+    bool encloses2D(Point const& point) const;
+
+    /**
+      Test many points at once.
+     @param[in]  points  Tested points.
+     @param[out] results Results in the order of points.
+     @return Number of points inside.
+     */
+    unsigned int enclosesBatch(std::vector<Point> const& points, std::vector<bool>* results) const;
+
+  private: /* Copying not allowed */
+    PreparedPolygon(PreparedPolygon const& source);
+    PreparedPolygon& operator=(PreparedPolygon const& source);
+
+  private:
+    enum EdgeParameter { PARAMETER_X, PARAMETER_Y, DEGENERATE };
+
+    struct Edge
+    {
+      Point begining;
+      double beginingX, beginingY;
+      double endX, endY;
+      double inverseSlope;
+      EdgeParameter parameter;
+      BoundingBox box;
+    };
+
+    std::vector<Edge>* edges;
+    BoundingBox box;
+
+    bool crossingParity(double x, double y) const;
+    bool isOnBorder(Point const& point) const;
+
+    void initialize(Polygon const& polygon);
+    void freeMemory();
+};
+
+/* Inlines */
+
+inline BoundingBox PreparedPolygon::boundingBox() const
+{
+  return box;
+}
+
+inline unsigned int PreparedPolygon::numberOfEdges() const
+{
+  return edges->size();
+}
+
+#endif
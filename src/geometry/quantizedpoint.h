@@ -0,0 +1,148 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/quantizedpoint.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Point snapped to an integer lattice.
+ *
+ * Point::operator== compares coordinates with a tolerance, which
+ * isn't transitive, so points can't be hashed or sorted by it.
+ * QuantizedPoint holds the integer coordinates of the lattice
+ * cell a point falls into. Equality, ordering and hash of these
+ * are exact, so they can serve as keys of maps and hash tables.
+ *
+ * The lattice step is libcity::LATTICE_STEP by default. Like all
+ * the coordinates it's given in the basic units of the library
+ * (see units.h), so it doesn't change with libcity::METER; one
+ * meter spans METER / LATTICE_STEP cells (10^6 with the default
+ * values of units.h). When the step is not
+ * smaller than libcity::COORDINATES_EPSILON, points equal by
+ * Point::operator== always end up in the same or in a
+ * neighbouring cell (the coordinates differ by at most one).
+ *
+ */
+
+#ifndef _QUANTIZEDPOINT_H_
+#define _QUANTIZEDPOINT_H_
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <sstream>
+
+#include "point.h"
+#include "units.h"
+
+class QuantizedPoint
+{
+  public:
+    QuantizedPoint();
+    QuantizedPoint(long long x, long long y, long long z = 0);
+
+    /**
+      Find the lattice cell of a point.
+     @param[in] point Quantized point.
+     @param[in] step  Size of the lattice cells.
+     */
+    explicit QuantizedPoint(Point const& point, double step = libcity::LATTICE_STEP);
+
+    long long x() const;
+    long long y() const;
+    long long z() const;
+
+    /** Centre of the cell on the lattice with given step. */
+    Point toPoint(double step = libcity::LATTICE_STEP) const;
+
+    /** Hash for use in hash tables, equal points give equal hash. */
+    size_t hash() const;
+
+    bool operator==(QuantizedPoint const& second) const;
+    bool operator!=(QuantizedPoint const& second) const;
+    bool operator<(QuantizedPoint const& second) const;
+
+    std::string toString() const;
+
+    static long long quantize(double coordinate, double step = libcity::LATTICE_STEP);
+
+  private:
+    long long xCell;
+    long long yCell;
+    long long zCell;
+};
+
+/* Inlines */
+
+inline QuantizedPoint::QuantizedPoint()
+  : xCell(0), yCell(0), zCell(0)
+{}
+
+inline QuantizedPoint::QuantizedPoint(long long x, long long y, long long z)
+  : xCell(x), yCell(y), zCell(z)
+{}
+
+inline QuantizedPoint::QuantizedPoint(Point const& point, double step)
+  : xCell(quantize(point.x(), step)),
+    yCell(quantize(point.y(), step)),
+    zCell(quantize(point.z(), step))
+{}
+
+inline long long QuantizedPoint::quantize(double coordinate, double step)
+{
+  return static_cast<long long>(std::floor(coordinate / step));
+}
+
+inline long long QuantizedPoint::x() const
+{
+  return xCell;
+}
+
+inline long long QuantizedPoint::y() const
+{
+  return yCell;
+}
+
+inline long long QuantizedPoint::z() const
+{
+  return zCell;
+}
+
+inline Point QuantizedPoint::toPoint(double step) const
+{
+  return Point((xCell + 0.5)*step, (yCell + 0.5)*step, (zCell + 0.5)*step);
+}
+
+inline size_t QuantizedPoint::hash() const
+{
+  unsigned long long value = static_cast<unsigned long long>(xCell)*73856093ULL ^
+                             static_cast<unsigned long long>(yCell)*19349663ULL ^
+                             static_cast<unsigned long long>(zCell)*83492791ULL;
+  return static_cast<size_t>(value ^ (value >> 32));
+}
+
+inline bool QuantizedPoint::operator==(QuantizedPoint const& second) const
+{
+  return xCell == second.xCell && yCell == second.yCell && zCell == second.zCell;
+}
+
+inline bool QuantizedPoint::operator!=(QuantizedPoint const& second) const
+{
+  return !(*this == second);
+}
+
+inline bool QuantizedPoint::operator<(QuantizedPoint const& second) const
+{
+  if (xCell != second.xCell) return xCell < second.xCell;
+  if (yCell != second.yCell) return yCell < second.yCell;
+  return zCell < second.zCell;
+}
+
+inline std::string QuantizedPoint::toString() const
+{
+  std::stringstream convertor;
+  convertor << "QuantizedPoint(" << xCell << ", " << yCell << ", " << zCell << ")";
+  return convertor.str();
+}
+
+#endif
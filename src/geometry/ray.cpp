@@ -20,82 +20,61 @@
 #include <cmath>
 
 Ray::Ray()
+  : rayOrigin(0,0,0), rayDirection(1,0,0)
 {
-  initialize();
-  rayOrigin->set(0,0,0);
-  rayDirection->set(1,0,0);
 }
 
 Ray::Ray(Point const& point, Vector const& vector)
+  : rayOrigin(point), rayDirection(vector)
 {
-  initialize();
-  *rayOrigin = point;
-  *rayDirection = vector;
 }
 
 Ray::Ray(Point const& firstPoint, Point const& secondPoint)
+  : rayOrigin(firstPoint), rayDirection(firstPoint, secondPoint)
 {
-  initialize();
-  *rayOrigin = firstPoint;
-  *rayDirection = Vector(firstPoint, secondPoint);
 }
 
 Ray::Ray(Ray const& source)
+  : rayOrigin(source.rayOrigin), rayDirection(source.rayDirection)
 {
-  initialize();
-  *rayOrigin = source.origin();
-  *rayDirection = source.direction();
 }
 
 Ray& Ray::operator=(Ray const& source)
 {
-  *rayOrigin = source.origin();
-  *rayDirection = source.direction();
+  rayOrigin = source.rayOrigin;
+  rayDirection = source.rayDirection;
   return *this;
 }
 
-void Ray::initialize()
-{
-  rayOrigin = new Point();
-  rayDirection = new Vector();
-}
-
 Ray::~Ray()
 {
-  freeMemory();
-}
-
-void Ray::freeMemory()
-{
-  delete rayOrigin;
-  delete rayDirection;
 }
 
 void Ray::set(Point const& point, Vector const& vector)
 {
-  *rayOrigin = point;
-  *rayDirection = vector;
+  rayOrigin = point;
+  rayDirection = vector;
 }
 
 void Ray::setOrigin(Point const& point)
 {
-  *rayOrigin = point;
+  rayOrigin = point;
 }
 
 void Ray::setDirection(Vector const& vector)
 {
 
-  *rayDirection = vector;
+  rayDirection = vector;
 }
 
 Point Ray::origin() const
 {
-  return *rayOrigin;
+  return rayOrigin;
 }
 
 Vector Ray::direction() const
 {
-  return *rayDirection;
+  return rayDirection;
 }
 
 
@@ -212,5 +191,5 @@ Ray::Intersection Ray::intersection2D(LineSegment const& another, Point* interse
 
 std::string Ray::toString()
 {
-  return "Ray(" + rayOrigin->toString() + ", " + rayDirection->toString() + ")";
+  return "Ray(" + rayOrigin.toString() + ", " + rayDirection.toString() + ")";
 }
@@ -16,8 +16,9 @@
 
 #include <string>
 
-class Point;
-class Vector;
+#include "point.h"
+#include "vector.h"
+
 class Line;
 class LineSegment;
 
@@ -57,11 +58,8 @@ class Ray
     //bool operator==(Ray const& second) const;
 
   private:
-    Point* rayOrigin;
-    Vector* rayDirection;
-
-    void initialize();
-    void freeMemory();
+    Point rayOrigin;
+    Vector rayDirection;
 };
 
 #endif
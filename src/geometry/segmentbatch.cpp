@@ -0,0 +1,205 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/segmentbatch.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see geometry/segmentbatch.h
+ *
+ */
+
+#include "segmentbatch.h"
+#include "point.h"
+#include "kernel.h"
+#include "units.h"
+#include "../debug.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef __SSE2__
+  #include <emmintrin.h>
+#endif
+
+const double SegmentBatch::ORIENTATION_TOLERANCE = 4*libcity::COORDINATES_EPSILON;
+const double SegmentBatch::RELATIVE_TOLERANCE = 1e-9;
+
+SegmentBatch::SegmentBatch()
+{
+  initialize();
+}
+
+void SegmentBatch::initialize()
+{
+  beginingX = new std::vector<double>;
+  beginingY = new std::vector<double>;
+  endX = new std::vector<double>;
+  endY = new std::vector<double>;
+}
+
+SegmentBatch::~SegmentBatch()
+{
+  freeMemory();
+}
+
+void SegmentBatch::freeMemory()
+{
+  delete beginingX;
+  delete beginingY;
+  delete endX;
+  delete endY;
+}
+
+void SegmentBatch::add(Point const& begining, Point const& end)
+{
+  beginingX->push_back(begining.x());
+  beginingY->push_back(begining.y());
+  endX->push_back(end.x());
+  endY->push_back(end.y());
+}
+
+void SegmentBatch::add(LineSegment const& segment)
+{
+  add(segment.begining(), segment.end());
+}
+
+void SegmentBatch::clear()
+{
+  beginingX->clear();
+  beginingY->clear();
+  endX->clear();
+  endY->clear();
+}
+
+size_t SegmentBatch::size() const
+{
+  return beginingX->size();
+}
+
+LineSegment SegmentBatch::segment(size_t index) const
+{
+  assert(index < size());
+  return LineSegment(Point((*beginingX)[index], (*beginingY)[index]),
+                     Point((*endX)[index], (*endY)[index]));
+}
+
+bool SegmentBatch::isCandidate(std::vector<MaskWord> const& candidates, size_t index)
+{
+  return (candidates[index / 32] >> (index % 32)) & 1;
+}
+
+LineSegment::Intersection SegmentBatch::intersection2D(LineSegment const& segment, size_t index,
+                                                       Point* intersection) const
+{
+  return segment.intersection2D(this->segment(index), intersection);
+}
+
+size_t SegmentBatch::findCandidates(LineSegment const& segment, std::vector<MaskWord>* candidates) const
+{
+  size_t count = size();
+  candidates->assign((count + 31) / 32, 0);
+
+  double ax = segment.begining().x(), ay = segment.begining().y(),
+         bx = segment.end().x(), by = segment.end().y();
+  /* How far apart may the bounding boxes be. */
+  double tolerance = LineSegment::BOX_TOLERANCE;
+  double minX = std::min(ax, bx) - tolerance, maxX = std::max(ax, bx) + tolerance,
+         minY = std::min(ay, by) - tolerance, maxY = std::max(ay, by) + tolerance;
+
+  const double* sax = count > 0 ? &(*beginingX)[0] : 0;
+  const double* say = count > 0 ? &(*beginingY)[0] : 0;
+  const double* sbx = count > 0 ? &(*endX)[0] : 0;
+  const double* sby = count > 0 ? &(*endY)[0] : 0;
+
+  size_t found = 0;
+  size_t i = 0;
+
+#ifdef __SSE2__
+  const __m128d vMinX = _mm_set1_pd(minX), vMaxX = _mm_set1_pd(maxX),
+                vMinY = _mm_set1_pd(minY), vMaxY = _mm_set1_pd(maxY);
+  const __m128d vAx = _mm_set1_pd(ax), vAy = _mm_set1_pd(ay),
+                vBx = _mm_set1_pd(bx), vBy = _mm_set1_pd(by);
+  const __m128d vDx = _mm_set1_pd(bx - ax), vDy = _mm_set1_pd(by - ay);
+  const __m128d vTolerance = _mm_set1_pd(ORIENTATION_TOLERANCE),
+                vRelative = _mm_set1_pd(RELATIVE_TOLERANCE),
+                vZero = _mm_setzero_pd();
+  /* Clears the sign bit */
+  const __m128d vAbsMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+
+  for (; i + 2 <= count; i += 2)
+  {
+    __m128d cAx = _mm_loadu_pd(sax + i), cAy = _mm_loadu_pd(say + i),
+            cBx = _mm_loadu_pd(sbx + i), cBy = _mm_loadu_pd(sby + i);
+
+    /* Bounding boxes */
+    __m128d inside = _mm_and_pd(_mm_cmpge_pd(_mm_max_pd(cAx, cBx), vMinX),
+                                _mm_cmple_pd(_mm_min_pd(cAx, cBx), vMaxX));
+    inside = _mm_and_pd(inside, _mm_cmpge_pd(_mm_max_pd(cAy, cBy), vMinY));
+    inside = _mm_and_pd(inside, _mm_cmple_pd(_mm_min_pd(cAy, cBy), vMaxY));
+
+    /* Ends of the batch segments relative to the tested one */
+    __m128d first  = _mm_sub_pd(_mm_mul_pd(vDx, _mm_sub_pd(cAy, vAy)),
+                                _mm_mul_pd(vDy, _mm_sub_pd(cAx, vAx)));
+    __m128d second = _mm_sub_pd(_mm_mul_pd(vDx, _mm_sub_pd(cBy, vAy)),
+                                _mm_mul_pd(vDy, _mm_sub_pd(cBx, vAx)));
+    __m128d limit = _mm_add_pd(vTolerance,
+                               _mm_mul_pd(vRelative, _mm_add_pd(_mm_and_pd(first, vAbsMask),
+                                                                _mm_and_pd(second, vAbsMask))));
+    __m128d negativeLimit = _mm_sub_pd(vZero, limit);
+    __m128d sameSide = _mm_or_pd(_mm_and_pd(_mm_cmpgt_pd(first, limit), _mm_cmpgt_pd(second, limit)),
+                                 _mm_and_pd(_mm_cmplt_pd(first, negativeLimit), _mm_cmplt_pd(second, negativeLimit)));
+
+    /* Ends of the tested segment relative to the batch ones */
+    __m128d cDx = _mm_sub_pd(cBx, cAx), cDy = _mm_sub_pd(cBy, cAy);
+    first  = _mm_sub_pd(_mm_mul_pd(cDx, _mm_sub_pd(vAy, cAy)),
+                        _mm_mul_pd(cDy, _mm_sub_pd(vAx, cAx)));
+    second = _mm_sub_pd(_mm_mul_pd(cDx, _mm_sub_pd(vBy, cAy)),
+                        _mm_mul_pd(cDy, _mm_sub_pd(vBx, cAx)));
+    limit = _mm_add_pd(vTolerance,
+                       _mm_mul_pd(vRelative, _mm_add_pd(_mm_and_pd(first, vAbsMask),
+                                                        _mm_and_pd(second, vAbsMask))));
+    negativeLimit = _mm_sub_pd(vZero, limit);
+    sameSide = _mm_or_pd(sameSide,
+                         _mm_or_pd(_mm_and_pd(_mm_cmpgt_pd(first, limit), _mm_cmpgt_pd(second, limit)),
+                                   _mm_and_pd(_mm_cmplt_pd(first, negativeLimit), _mm_cmplt_pd(second, negativeLimit))));
+
+    int bits = _mm_movemask_pd(_mm_andnot_pd(sameSide, inside));
+    if (bits != 0)
+    {
+      (*candidates)[i / 32] |= static_cast<MaskWord>(bits) << (i % 32);
+      found += (bits & 1) + ((bits >> 1) & 1);
+    }
+  }
+#endif
+
+  for (; i < count; i++)
+  {
+    if (std::max(sax[i], sbx[i]) < minX || std::min(sax[i], sbx[i]) > maxX ||
+        std::max(say[i], sby[i]) < minY || std::min(say[i], sby[i]) > maxY)
+    {
+      continue;
+    }
+
+    double first  = libcity::orient2d(ax, ay, bx, by, sax[i], say[i]),
+           second = libcity::orient2d(ax, ay, bx, by, sbx[i], sby[i]),
+           limit  = ORIENTATION_TOLERANCE + RELATIVE_TOLERANCE*(std::abs(first) + std::abs(second));
+    if ((first > limit && second > limit) || (first < -limit && second < -limit))
+    {
+      continue;
+    }
+
+    first  = libcity::orient2d(sax[i], say[i], sbx[i], sby[i], ax, ay);
+    second = libcity::orient2d(sax[i], say[i], sbx[i], sby[i], bx, by);
+    limit  = ORIENTATION_TOLERANCE + RELATIVE_TOLERANCE*(std::abs(first) + std::abs(second));
+    if ((first > limit && second > limit) || (first < -limit && second < -limit))
+    {
+      continue;
+    }
+
+    (*candidates)[i / 32] |= static_cast<MaskWord>(1) << (i % 32);
+    found++;
+  }
+
+  return found;
+}
@@ -0,0 +1,91 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/segmentbatch.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Array of line segments tested against one segment at once.
+ *
+ * Coordinates of the segments are stored in four separate
+ * arrays (structure of arrays), so the candidate test runs
+ * on two segments at a time with SSE2 when it's available.
+ * A scalar loop computing the same thing is used otherwise.
+ *
+ * The candidate test is conservative. Every segment for which
+ * LineSegment::intersection2D() would report anything else than
+ * NONINTERSECTING is marked as a candidate. Only candidates
+ * need to be classified exactly with intersection2D().
+ *
+ */
+
+#ifndef _SEGMENTBATCH_H_
+#define _SEGMENTBATCH_H_
+
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+
+#include "linesegment.h"
+
+class Point;
+
+class SegmentBatch
+{
+  public:
+    SegmentBatch();
+    ~SegmentBatch();
+
+    typedef uint32_t MaskWord;
+
+    void add(Point const& begining, Point const& end);
+    void add(LineSegment const& segment);
+    void clear();
+
+    size_t size() const;
+    LineSegment segment(size_t index) const;
+
+    /**
+      Find segments of the batch that may intersect with
+      another segment.
+     @param[in]  segment    Tested segment.
+     @param[out] candidates Bit mask, bit i of word i/32 is set
+                            when segment i is a candidate.
+     @return Number of candidates.
+     */
+    size_t findCandidates(LineSegment const& segment, std::vector<MaskWord>* candidates) const;
+
+    static bool isCandidate(std::vector<MaskWord> const& candidates, size_t index);
+
+    /**
+      Classify the intersection with one segment of the batch
+      exactly, the same way LineSegment::intersection2D() does.
+     @param[in]  segment      Tested segment.
+     @param[in]  index        Index of segment in the batch.
+     @param[out] intersection Point of intersection.
+     */
+    LineSegment::Intersection intersection2D(LineSegment const& segment, size_t index,
+                                             Point* intersection) const;
+
+  private: /* Copying not allowed */
+    SegmentBatch(SegmentBatch const& source);
+    SegmentBatch& operator=(SegmentBatch const& source);
+
+  private:
+    /**
+      Orientation tests must exceed this value (plus small part
+      of their magnitude) for the segments to be rejected.
+     */
+    static const double ORIENTATION_TOLERANCE;
+    static const double RELATIVE_TOLERANCE;
+
+    std::vector<double>* beginingX;
+    std::vector<double>* beginingY;
+    std::vector<double>* endX;
+    std::vector<double>* endY;
+
+    void initialize();
+    void freeMemory();
+};
+
+#endif
@@ -0,0 +1,197 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/triangulator.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see geometry/triangulator.h
+ *
+ */
+
+#include "triangulator.h"
+#include "polygon.h"
+#include "point.h"
+#include "units.h"
+#include "predicates.h"
+#include "../debug.h"
+
+#include <algorithm>
+
+namespace
+{
+  /* Point on the border is inside. */
+  bool isInsideTriangle(double Ax, double Ay,
+                        double Bx, double By,
+                        double Cx, double Cy,
+                        double Px, double Py)
+  {
+    return libcity::orient2dRobust(Bx, By, Cx, Cy, Px, Py) >= 0.0 &&
+           libcity::orient2dRobust(Cx, Cy, Ax, Ay, Px, Py) >= 0.0 &&
+           libcity::orient2dRobust(Ax, Ay, Bx, By, Px, Py) >= 0.0;
+  }
+}
+
+Triangulator::Triangulator()
+{
+  initialize();
+}
+
+void Triangulator::initialize()
+{
+  x = new std::vector<double>;
+  y = new std::vector<double>;
+  original = new std::vector<int>;
+  next = new std::vector<int>;
+  previous = new std::vector<int>;
+  reflexVertices = new std::vector<int>;
+  isReflex = new std::vector<bool>;
+}
+
+Triangulator::~Triangulator()
+{
+  freeMemory();
+}
+
+void Triangulator::freeMemory()
+{
+  delete x;
+  delete y;
+  delete original;
+  delete next;
+  delete previous;
+  delete reflexVertices;
+  delete isReflex;
+}
+
+bool Triangulator::isConvex(int previousVertex, int vertex, int nextVertex) const
+{
+  double Ax = (*x)[previousVertex], Ay = (*y)[previousVertex],
+         Bx = (*x)[vertex],         By = (*y)[vertex],
+         Cx = (*x)[nextVertex],     Cy = (*y)[nextVertex];
+
+  return libcity::EPSILON <= (((Bx-Ax)*(Cy-Ay)) - ((By-Ay)*(Cx-Ax)));
+}
+
+bool Triangulator::isEar(int first, int second, int third) const
+{
+  if (!isConvex(first, second, third))
+  {
+    return false;
+  }
+
+  for (std::vector<int>::const_iterator vertex = reflexVertices->begin();
+       vertex != reflexVertices->end();
+       vertex++)
+  {
+    if (*vertex == first || *vertex == second || *vertex == third) continue;
+
+    if (isInsideTriangle((*x)[first], (*y)[first],
+                         (*x)[second], (*y)[second],
+                         (*x)[third], (*y)[third],
+                         (*x)[*vertex], (*y)[*vertex]))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Triangulator::updateReflexState(int vertex)
+{
+  bool reflex = !isConvex((*previous)[vertex], vertex, (*next)[vertex]);
+  if (reflex == (*isReflex)[vertex])
+  {
+    return;
+  }
+
+  (*isReflex)[vertex] = reflex;
+  if (reflex)
+  {
+    reflexVertices->push_back(vertex);
+  }
+  else
+  {
+    reflexVertices->erase(std::find(reflexVertices->begin(), reflexVertices->end(), vertex));
+  }
+}
+
+bool Triangulator::triangulate(Polygon const& polygon, std::vector<int>* indexes)
+{
+  int n = polygon.numberOfVertices();
+  assert(n >= 3);
+
+  indexes->clear();
+  x->resize(n);
+  y->resize(n);
+  original->resize(n);
+  next->resize(n);
+  previous->resize(n);
+
+  /* we want a counter-clockwise polygon */
+  bool isCounterclockwise = polygon.isCounterclockwise();
+  for (int v = 0; v < n; v++)
+  {
+    int index = isCounterclockwise ? v : (n-1)-v;
+    Point vertex = polygon.vertex(index);
+
+    (*x)[v] = vertex.x();
+    (*y)[v] = vertex.y();
+    (*original)[v] = index;
+    (*next)[v] = (v + 1) % n;
+    (*previous)[v] = (v + n - 1) % n;
+  }
+
+  reflexVertices->clear();
+  isReflex->assign(n, false);
+  for (int v = 0; v < n; v++)
+  {
+    updateReflexState(v);
+  }
+
+  int remaining = n;
+
+  /* error detection */
+  int count = 2*remaining;
+
+  int u = n - 1;
+  while (remaining > 2)
+  {
+    /* if we loop, it is probably a non-simple polygon */
+    if (0 >= (count--))
+    {
+      return false;
+    }
+
+    /* three consecutive vertices in current polygon, <u,v,w> */
+    int v = (*next)[u],
+        w = (*next)[v];
+
+    if (isEar(u, v, w))
+    {
+      indexes->push_back((*original)[u]);
+      indexes->push_back((*original)[v]);
+      indexes->push_back((*original)[w]);
+
+      /* remove v from remaining polygon */
+      (*next)[u] = w;
+      (*previous)[w] = u;
+      remaining--;
+
+      updateReflexState(u);
+      updateReflexState(w);
+
+      /* continue with the triangle following the clipped one */
+      u = w;
+
+      count = 2*remaining;
+    }
+    else
+    {
+      u = v;
+    }
+  }
+
+  return true;
+}
@@ -0,0 +1,78 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/triangulator.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Ear clipping triangulation of simple polygons.
+ *
+ * Remaining vertices are kept in a circular linked list,
+ * so clipping an ear is O(1). Only reflex vertices can lie
+ * inside an ear of a simple polygon, so only those are
+ * tested against the candidate triangle.
+ *
+ * Ears are searched in the same order as the original
+ * flipcode implementation used by Polygon, including
+ * the detection of polygons that can't be triangulated.
+ *
+ * All the working memory is owned by the triangulator and
+ * reused, so keep one around when triangulating many polygons.
+ *
+ */
+
+#ifndef _TRIANGULATOR_H_
+#define _TRIANGULATOR_H_
+
+#include <vector>
+
+class Polygon;
+
+class Triangulator
+{
+  public:
+    Triangulator();
+    ~Triangulator();
+
+    /**
+      Triangulate a polygon.
+     @remarks
+       The output buffer is cleared first, its capacity is kept.
+       When the polygon isn't simple, triangles found until the
+       failure are left in the buffer.
+     @param[in]  polygon Polygon with at least 3 vertices.
+     @param[out] indexes Indexes of polygon's vertices, three for
+                         every triangle, counter-clockwise.
+     @return False if the polygon couldn't be triangulated.
+     */
+    bool triangulate(Polygon const& polygon, std::vector<int>* indexes);
+
+  private: /* Copying not allowed */
+    Triangulator(Triangulator const& source);
+    Triangulator& operator=(Triangulator const& source);
+
+  private:
+    /** Vertex coordinates, counter-clockwise. */
+    std::vector<double>* x;
+    std::vector<double>* y;
+
+    /** Original index of each vertex. */
+    std::vector<int>* original;
+
+    /** Circular list of vertices not clipped yet. */
+    std::vector<int>* next;
+    std::vector<int>* previous;
+
+    /** Vertices which may block an ear. */
+    std::vector<int>* reflexVertices;
+    std::vector<bool>* isReflex;
+
+    bool isConvex(int previousVertex, int vertex, int nextVertex) const;
+    bool isEar(int first, int second, int third) const;
+    void updateReflexState(int vertex);
+
+    void initialize();
+    void freeMemory();
+};
+
+#endif
@@ -9,6 +9,9 @@
  *
  */
 
+#ifndef _UNITS_H_
+#define _UNITS_H_
+
 namespace libcity
 {
   /* Basic unit for the whole library (in pixels). */
@@ -20,5 +23,10 @@ namespace libcity
   const double COORDINATES_EPSILON = 0.0001;
   const double EPSILON = 0.0000001;
 
+  /* Size of the cells of QuantizedPoint's lattice (in pixels, not meters). */
+  const double LATTICE_STEP = COORDINATES_EPSILON;
+
   const double SNAP_DISTANCE = 25;
-}
\ No newline at end of file
+}
+
+#endif
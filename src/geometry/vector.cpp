@@ -18,55 +18,6 @@
 #include <sstream>
 #include <cmath>
 
-Vector::Vector()
-  : xDirection(0.0), yDirection(0.0), zDirection(0.0)
-{}
-
-Vector::Vector(double x)
-  : xDirection(x), yDirection(0.0), zDirection(0.0)
-{}
-
-Vector::Vector(double x, double y)
-  : xDirection(x), yDirection(y), zDirection(0.0)
-{}
-
-Vector::Vector(double x, double y, double z)
-  : xDirection(x), yDirection(y), zDirection(z)
-{}
-
-Vector::~Vector()
-{}
-
-double Vector::x() const
-{
-  return xDirection;
-}
-
-double Vector::y() const
-{
-  return yDirection;
-}
-
-double Vector::z() const
-{
-  return zDirection;
-}
-
-void Vector::setX(double coordinate)
-{
-  xDirection = coordinate;
-}
-
-void Vector::setY(double coordinate)
-{
-  yDirection = coordinate;
-}
-
-void Vector::setZ(double coordinate)
-{
-  zDirection = coordinate;
-}
-
 void Vector::rotate(double xDegrees, double yDegrees, double zDegrees)
 {
   rotateAroundX(xDegrees);
@@ -118,63 +69,20 @@ void Vector::rotateAroundZ(double degrees)
   zDirection = newZ;
 }
 
-void Vector::normalize()
-{
-  double vectorLength = length();
-
-  xDirection /= vectorLength;
-  yDirection /= vectorLength;
-  zDirection /= vectorLength;
-}
-
-double Vector::length() const
-{
-  return sqrt(xDirection*xDirection + yDirection*yDirection + zDirection*zDirection);
-}
-
-double Vector::squaredLength() const
-{
-  return xDirection*xDirection + yDirection*yDirection + zDirection*zDirection;
-}
-
-void Vector::set(double xCoord, double yCoord, double zCoord)
-{
-  xDirection = xCoord;
-  yDirection = yCoord;
-  zDirection = zCoord;
-}
-
-void Vector::set(Point const& from, Point const& to)
-{
-  xDirection = to.x() - from.x();
-  yDirection = to.y() - from.y();
-  zDirection = to.z() - from.z();
-}
-
-std::string Vector::toString()
+std::string Vector::toString() const
 {
   std::stringstream convertor;
   convertor << "Vector(" << xDirection << ", " << yDirection << ", " << zDirection << ")";
   return convertor.str();
 }
 
-double Vector::dotProduct(Vector const& vector)
-{
-  return x()*vector.x() + y()*vector.y() + z()*vector.z();
-}
-
-double Vector::perpDotProduct(Vector const& vector)
-{
-  return x()*vector.y() - vector.x()*y();
-}
-
-bool Vector::isParallelWith(Vector const& second)
+bool Vector::isParallelWith(Vector const& second) const
 {
   double angle = angleTo(second);
   return std::abs(angle - 0) <= libcity::EPSILON || std::abs(angle - libcity::PI) <= libcity::EPSILON;
 }
 
-Vector Vector::crossProduct(Vector const& vector)
+Vector Vector::crossProduct(Vector const& vector) const
 {
   /* Vectors are parallel, thats undefined. */
   assert(!isParallelWith(vector));
@@ -186,7 +94,7 @@ Vector Vector::crossProduct(Vector const& vector)
   return Vector(resultX, resultY, resultZ);
 }
 
-double Vector::angleTo(Vector const& vector)
+double Vector::angleTo(Vector const& vector) const
 {
   Vector first(*this), second(vector);
   first.normalize();
@@ -208,7 +116,7 @@ double Vector::angleTo(Vector const& vector)
   return std::acos(product);
 }
 
-double Vector::angleToXAxis()
+double Vector::angleToXAxis() const
 {
   /* This produces results in the range (−PI, PI], which can be
   mapped to [0, 2PI) by adding 2PI to negative values. */
@@ -222,39 +130,3 @@ double Vector::angleToXAxis()
   return angle;
 }
 
-bool   Vector::operator==(Vector const& second)
-{
-  return std::abs(xDirection - second.x()) < libcity::COORDINATES_EPSILON &&
-         std::abs(yDirection - second.y()) < libcity::COORDINATES_EPSILON &&
-         std::abs(zDirection - second.z()) < libcity::COORDINATES_EPSILON;
-}
-
-bool   Vector::operator!=(Vector const& second)
-{
-  return !(*this == second);
-}
-
-Vector Vector::operator*(double constant)
-{
-  return Vector(constant*xDirection, constant*yDirection, constant*zDirection);
-}
-
-Vector Vector::operator/(double constant)
-{
-  return Vector(xDirection/constant, yDirection/constant, zDirection/constant);
-}
-
-Vector Vector::operator+(Vector const& vector)
-{
-  return Vector(xDirection + vector.x(), yDirection + vector.y(), zDirection + vector.z());
-}
-
-Vector::Vector(Point const& from, Point const& to)
-{
-  set(from, to);
-}
-
-Point Vector::toPoint()
-{
-  return Point(xDirection, yDirection, zDirection);
-}
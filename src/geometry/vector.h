@@ -7,6 +7,8 @@
  *
  * @brief Vector in 3D space. But can also represent 2D and 1D vectors.
  *
+ * Arithmetic is inline and built on the functions from kernel.h.
+ *
  */
 
 #ifndef _VECTOR_H_
@@ -14,10 +16,10 @@
 
 /* STL */
 #include <string>
+#include <cmath>
 
 #include "point.h"
-
-class Point;
+#include "kernel.h"
 
 class Vector
 {
@@ -34,8 +36,6 @@ class Vector
 //     Vector(Vector const& source);
 //     Vector& operator=(Vector const& source);
 
-    ~Vector();
-
   private:
     double xDirection;
     double yDirection;
@@ -90,7 +90,7 @@ class Vector
      @param[in] vector Second vector for the dot product.
      @return Dot product result.
      */
-    double dotProduct(Vector const& vector);
+    double dotProduct(Vector const& vector) const;
 
     /**
       Compute 'perp dot' product.
@@ -103,7 +103,7 @@ class Vector
      @param[in] vector Second vector for the dot product.
      @return Resulting product.
      */
-    double perpDotProduct(Vector const& vector);
+    double perpDotProduct(Vector const& vector) const;
 
     /**
       Compute cross product of the two vectors.
@@ -113,7 +113,7 @@ class Vector
      @param[in] vector Second vector for the cross product.
      @return Resulting product.
       */
-    Vector crossProduct(Vector const& vector);
+    Vector crossProduct(Vector const& vector) const;
 
     /**
       Compute angle between two vectors.
@@ -126,14 +126,14 @@ class Vector
      @param[in] second Vector wich angle we want to determine from current vector.
      @return Resulting angle in RADIANS.
      */
-    double angleTo(Vector const& second);
+    double angleTo(Vector const& second) const;
 
     /**
       Determine if the two Vectors are parallel.
      @param[in] second The second Vector of the two.
      @return True if they are parallel, otherwise false.
      */
-    bool isParallelWith(Vector const& second);
+    bool isParallelWith(Vector const& second) const;
 
     /**
       Compute angle between the Vector and X axis (Vector(1,0)).
@@ -144,20 +144,172 @@ class Vector
 
      @return Resulting angle in RADIANS.
      */
-    double angleToXAxis();
+    double angleToXAxis() const;
 
-    bool   operator==(Vector const& second);
-    bool   operator!=(Vector const& second);
-    Vector operator*(double constant);
-    Vector operator/(double constant);
-    Vector operator+(Vector const& vector);
+    bool   operator==(Vector const& second) const;
+    bool   operator!=(Vector const& second) const;
+    Vector operator*(double constant) const;
+    Vector operator/(double constant) const;
+    Vector operator+(Vector const& vector) const;
 
-    Point toPoint();
+    Point toPoint() const;
 
     /**
       Returns vector as a string for debugging purposes.
      @return Format is like: Vector(x, y, z).
      */
-    std::string toString();
+    std::string toString() const;
 };
-#endif
\ No newline at end of file
+
+inline Vector::Vector()
+  : xDirection(0.0), yDirection(0.0), zDirection(0.0)
+{}
+
+inline Vector::Vector(double x)
+  : xDirection(x), yDirection(0.0), zDirection(0.0)
+{}
+
+inline Vector::Vector(double x, double y)
+  : xDirection(x), yDirection(y), zDirection(0.0)
+{}
+
+inline Vector::Vector(double x, double y, double z)
+  : xDirection(x), yDirection(y), zDirection(z)
+{}
+
+inline Vector::Vector(Point const& from, Point const& to)
+  : xDirection(to.x() - from.x()),
+    yDirection(to.y() - from.y()),
+    zDirection(to.z() - from.z())
+{}
+
+inline double Vector::x() const
+{
+  return xDirection;
+}
+
+inline double Vector::y() const
+{
+  return yDirection;
+}
+
+inline double Vector::z() const
+{
+  return zDirection;
+}
+
+inline void Vector::setX(double coordinate)
+{
+  xDirection = coordinate;
+}
+
+inline void Vector::setY(double coordinate)
+{
+  yDirection = coordinate;
+}
+
+inline void Vector::setZ(double coordinate)
+{
+  zDirection = coordinate;
+}
+
+inline void Vector::set(double xCoord, double yCoord, double zCoord)
+{
+  xDirection = xCoord;
+  yDirection = yCoord;
+  zDirection = zCoord;
+}
+
+inline void Vector::set(Point const& from, Point const& to)
+{
+  xDirection = to.x() - from.x();
+  yDirection = to.y() - from.y();
+  zDirection = to.z() - from.z();
+}
+
+inline double Vector::length() const
+{
+  return std::sqrt(squaredLength());
+}
+
+inline double Vector::squaredLength() const
+{
+  return libcity::dot3D(xDirection, yDirection, zDirection,
+                        xDirection, yDirection, zDirection);
+}
+
+inline void Vector::normalize()
+{
+  double vectorLength = length();
+
+  xDirection /= vectorLength;
+  yDirection /= vectorLength;
+  zDirection /= vectorLength;
+}
+
+inline double Vector::dotProduct(Vector const& vector) const
+{
+  return libcity::dot3D(xDirection, yDirection, zDirection,
+                        vector.xDirection, vector.yDirection, vector.zDirection);
+}
+
+inline double Vector::perpDotProduct(Vector const& vector) const
+{
+  return libcity::cross2D(xDirection, yDirection, vector.xDirection, vector.yDirection);
+}
+
+inline bool Vector::operator==(Vector const& second) const
+{
+  return std::abs(xDirection - second.xDirection) < libcity::COORDINATES_EPSILON &&
+         std::abs(yDirection - second.yDirection) < libcity::COORDINATES_EPSILON &&
+         std::abs(zDirection - second.zDirection) < libcity::COORDINATES_EPSILON;
+}
+
+inline bool Vector::operator!=(Vector const& second) const
+{
+  return !(*this == second);
+}
+
+inline Vector Vector::operator*(double constant) const
+{
+  return Vector(constant*xDirection, constant*yDirection, constant*zDirection);
+}
+
+inline Vector Vector::operator/(double constant) const
+{
+  return Vector(xDirection/constant, yDirection/constant, zDirection/constant);
+}
+
+inline Vector Vector::operator+(Vector const& vector) const
+{
+  return Vector(xDirection + vector.xDirection,
+                yDirection + vector.yDirection,
+                zDirection + vector.zDirection);
+}
+
+inline Point Vector::toPoint() const
+{
+  return Point(xDirection, yDirection, zDirection);
+}
+
+/* Point operations involving Vector */
+inline Point& Point::operator+=(Vector const& difference)
+{
+  xPosition += difference.x();
+  yPosition += difference.y();
+  zPosition += difference.z();
+
+  return *this;
+}
+
+inline Point Point::operator+(Vector const& difference) const
+{
+  return Point(xPosition + difference.x(), yPosition + difference.y(), zPosition + difference.z());
+}
+
+inline Vector Point::operator-(Point const& second) const
+{
+  return Vector(second, *this);
+}
+
+#endif
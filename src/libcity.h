@@ -40,6 +40,17 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "geometry/polygon.h"
 #include "geometry/ray.h"
 #include "geometry/shape.h"
+#include "geometry/boundingbox.h"
+#include "geometry/kernel.h"
+#include "geometry/predicates.h"
+#include "geometry/quantizedpoint.h"
+#include "geometry/compactpolygon.h"
+#include "geometry/segmentbatch.h"
+#include "geometry/preparedpolygon.h"
+#include "geometry/triangulator.h"
+#include "geometry/polygonoffset.h"
+#include "geometry/polygonsplitter.h"
+#include "geometry/orientedbox.h"
 
 #include "streetgraph/road.h"
 #include "streetgraph/path.h"
@@ -48,6 +59,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "streetgraph/rasterroadpattern.h"
 #include "streetgraph/organicroadpattern.h"
 #include "streetgraph/areaextractor.h"
+#include "streetgraph/intersectionindex.h"
+#include "streetgraph/roadindex.h"
+#include "streetgraph/faceindex.h"
+#include "streetgraph/compactstreetgraph.h"
 
 #include "area/area.h"
 #include "area/zone.h"
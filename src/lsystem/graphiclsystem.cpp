@@ -171,74 +171,63 @@ void GraphicLSystem::setInitialDirection(Vector const& direction)
 /* ********************* */
 /* Cursor IMPLEMENTATION */
 GraphicLSystem::Cursor::Cursor()
-  : position(0), direction(0)
+  : position(0,0,0), direction(0,0,0)
 {
-  position  = new Point(0,0,0);
-  direction = new Vector(0,0,0);
 }
 
 GraphicLSystem::Cursor::Cursor(Point const& inputPosition, Vector const& inputDirection)
-  : position(0), direction(0)
+  : position(inputPosition), direction(inputDirection)
 {
-  position  = new Point(inputPosition);
-  direction = new Vector(inputDirection);
 }
 
 GraphicLSystem::Cursor::Cursor(Cursor const& source)
+  : position(source.position), direction(source.direction)
 {
-  position  = new Point(0,0,0);
-  direction = new Vector(0,0,0);
-
-  *position  = source.getPosition();
-  *direction = source.getDirection();
 }
 
-
 GraphicLSystem::Cursor& GraphicLSystem::Cursor::operator=(Cursor const& source)
 {
-  *position  = source.getPosition();
-  *direction = source.getDirection();
+  position  = source.position;
+  direction = source.direction;
 
   return *this;
 }
 
 GraphicLSystem::Cursor::~Cursor()
 {
-  delete position;
-  delete direction;
 }
 
 Point GraphicLSystem::Cursor::getPosition() const
 {
-  return *position;
+  return position;
 }
 
 Vector GraphicLSystem::Cursor::getDirection() const
 {
-  return *direction;
+  return direction;
 }
 
 void GraphicLSystem::Cursor::setPosition(Point const& newPosition)
 {
-  *position = newPosition;
+  position = newPosition;
 }
 
 void GraphicLSystem::Cursor::setDirection(Vector const& newDirection)
 {
-  *direction = newDirection;
-  direction->normalize();
+  direction = newDirection;
+  direction.normalize();
 }
 
 void GraphicLSystem::Cursor::move(double distance)
 {
-  direction->normalize();
-  position->setX(position->x() + direction->x()*distance);
-  position->setY(position->y() + direction->y()*distance);
-  position->setZ(position->z() + direction->z()*distance);
+  direction.normalize();
+  position.setX(position.x() + direction.x()*distance);
+  position.setY(position.y() + direction.y()*distance);
+  position.setZ(position.z() + direction.z()*distance);
 }
 
 void GraphicLSystem::Cursor::turn(double angle)
 {
-  direction->rotateAroundZ(angle);
-  direction->normalize();
+  direction.rotateAroundZ(angle);
+  direction.normalize();
 }
@@ -25,9 +25,8 @@
 #include <vector>
 
 #include "lsystem.h"
-
-class Point;
-class Vector;
+#include "../geometry/point.h"
+#include "../geometry/vector.h"
 
 class GraphicLSystem : public LSystem
 {
@@ -77,8 +76,8 @@ class GraphicLSystem : public LSystem
         void move(double distance);
         void turn(double angle);
       private:
-        Point*  position;
-        Vector* direction;
+        Point  position;
+        Vector direction;
     };
 
     /**
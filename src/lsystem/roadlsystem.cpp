@@ -15,6 +15,7 @@
 #include "../geometry/point.h"
 #include "../geometry/linesegment.h"
 #include "../geometry/polygon.h"
+#include "../geometry/boundingbox.h"
 #include "../geometry/units.h"
 #include "../streetgraph/road.h"
 #include "../streetgraph/intersection.h"
@@ -159,8 +160,14 @@ bool RoadLSystem::localConstraints(Path* proposedPath)
 
   Point intersection;
   double distance;
-  for (std::list<Road*>::iterator currentRoad = targetStreetGraph->begin();
-        currentRoad != targetStreetGraph->end();
+
+  /* Roads further than snapDistance from the path can't affect it. */
+  BoundingBox area(proposedPath->begining(), proposedPath->end());
+  area.expand(snapDistance);
+  std::vector<Road*> nearRoads = targetStreetGraph->getRoadsInArea(area);
+
+  for (std::vector<Road*>::iterator currentRoad = nearRoads.begin();
+        currentRoad != nearRoads.end();
         currentRoad++)
   {
     // Check for intersection
@@ -263,8 +270,12 @@ bool RoadLSystem::localConstraints(Path* proposedPath)
     return false;
   }
 
-  for (std::list<Road*>::iterator currentRoad = targetStreetGraph->begin();
-        currentRoad != targetStreetGraph->end();
+  area = BoundingBox(proposedPath->begining(), proposedPath->end());
+  area.expand(libcity::COORDINATES_EPSILON);
+  nearRoads = targetStreetGraph->getRoadsInArea(area);
+
+  for (std::vector<Road*>::iterator currentRoad = nearRoads.begin();
+        currentRoad != nearRoads.end();
         currentRoad++)
   {
     // Check for intersection
@@ -11,6 +11,7 @@
 
 #include "areaextractor.h"
 #include "intersection.h"
+#include "compactstreetgraph.h"
 #include "../area/zone.h"
 #include "../area/block.h"
 #include "../streetgraph/streetgraph.h"
@@ -18,11 +19,63 @@
 #include "../geometry/point.h"
 #include "../geometry/line.h"
 #include "../geometry/polygon.h"
+#include "../geometry/preparedpolygon.h"
+#include "../geometry/polygonoffset.h"
 #include "../geometry/vector.h"
+#include "../geometry/predicates.h"
 #include "../debug.h"
 
+#include <algorithm>
 #include <cmath>
 
+namespace
+{
+  /** Neighbouring node and the type of the road leading to it. */
+  typedef std::pair<int, Road::Type> Neighbour;
+
+  /** Orders neighbours counter-clockwise around center. */
+  class CounterclockwiseOrder
+  {
+    public:
+      CounterclockwiseOrder(Point const& center, std::vector<Intersection*> const* nodes)
+        : center(center), nodes(nodes)
+      {}
+
+      bool operator()(Neighbour const& first, Neighbour const& second) const
+      {
+        Point const& firstPosition = (*nodes)[first.first]->position();
+        Point const& secondPosition = (*nodes)[second.first]->position();
+        return libcity::isCounterclockwiseBefore(center.x(), center.y(),
+                                                 firstPosition.x(), firstPosition.y(),
+                                                 secondPosition.x(), secondPosition.y());
+      }
+
+    private:
+      Point center;
+      std::vector<Intersection*> const* nodes;
+  };
+
+  /** Orders intersections of a compact graph from left to right (and lower first). */
+  class LeftAndLower
+  {
+    public:
+      LeftAndLower(CompactStreetGraph const& graph)
+        : graph(graph)
+      {}
+
+      bool operator()(CompactStreetGraph::Index first, CompactStreetGraph::Index second) const
+      {
+        return graph.x(first) < graph.x(second) ||
+               (graph.x(first) == graph.x(second) && graph.y(first) < graph.y(second));
+      }
+
+    private:
+      CompactStreetGraph const& graph;
+  };
+}
+
+const int AreaExtractor::NO_NODE = -1;
+
 AreaExtractor::AreaExtractor()
 {
   initialize();
@@ -30,20 +83,43 @@ AreaExtractor::AreaExtractor()
 
 void AreaExtractor::initialize()
 {
-  vertices = new std::list<Intersection*>;
-  adjacentNodes = new std::map< Intersection*, std::vector<Intersection*> >;
-  cycleEdges = new std::set< std::pair<Intersection*, Intersection*> >;
+  nodes = new std::vector<Intersection*>;
+  removedNodes = new std::vector<bool>;
+  adjacencyStart = new std::vector<int>;
+  adjacencyCount = new std::vector<int>;
+  adjacency = new std::vector<int>;
+  adjacencyEdges = new std::vector<int>;
+  cycleEdges = new std::vector<bool>;
+  edgeTypes = new std::vector<Road::Type>;
+  edgeWidths = new std::vector<double>;
+  visitedNodes = new std::vector<bool>;
   cycles = new std::list<Polygon>;
+  pendingCycles = new std::vector<Polygon>;
+  pendingBoundaries = new std::vector<Polygon>;
+  pendingDistances = new std::vector< std::vector<double> >;
+  extractInParallel = false;
 
   reset();
 }
 
 void AreaExtractor::reset()
 {
-  vertices->clear();
-  adjacentNodes->clear();
+  nodes->clear();
+  removedNodes->clear();
+  firstRemainingNode = 0;
+  numberOfRemainingNodes = 0;
+  adjacencyStart->clear();
+  adjacencyCount->clear();
+  adjacency->clear();
+  adjacencyEdges->clear();
   cycleEdges->clear();
+  edgeTypes->clear();
+  edgeWidths->clear();
+  visitedNodes->clear();
   cycles->clear();
+  pendingCycles->clear();
+  pendingBoundaries->clear();
+  pendingDistances->clear();
   substractRoadWidthFromAreas = false;
 }
 
@@ -54,30 +130,47 @@ AreaExtractor::~AreaExtractor()
 
 void AreaExtractor::freeMemory()
 {
-  delete vertices;
-  delete adjacentNodes;
+  delete nodes;
+  delete removedNodes;
+  delete adjacencyStart;
+  delete adjacencyCount;
+  delete adjacency;
+  delete adjacencyEdges;
   delete cycleEdges;
+  delete edgeTypes;
+  delete edgeWidths;
+  delete visitedNodes;
   delete cycles;
+  delete pendingCycles;
+  delete pendingBoundaries;
+  delete pendingDistances;
 }
 
 AreaExtractor::AreaExtractor(AreaExtractor const& source)
 {
   initialize();
-
-  *vertices      = *(source.vertices);
-  *adjacentNodes = *(source.adjacentNodes);
-  *cycleEdges    = *(source.cycleEdges);
-  *cycles        = *(source.cycles);
+  *this = source;
 }
 
 AreaExtractor& AreaExtractor::operator=(AreaExtractor const& source)
 {
   reset();
 
-  *vertices      = *(source.vertices);
-  *adjacentNodes = *(source.adjacentNodes);
-  *cycleEdges    = *(source.cycleEdges);
-  *cycles        = *(source.cycles);
+  *nodes                 = *(source.nodes);
+  *removedNodes          = *(source.removedNodes);
+  firstRemainingNode     = source.firstRemainingNode;
+  numberOfRemainingNodes = source.numberOfRemainingNodes;
+  *adjacencyStart        = *(source.adjacencyStart);
+  *adjacencyCount        = *(source.adjacencyCount);
+  *adjacency             = *(source.adjacency);
+  *adjacencyEdges        = *(source.adjacencyEdges);
+  *cycleEdges            = *(source.cycleEdges);
+  *edgeTypes             = *(source.edgeTypes);
+  *edgeWidths            = *(source.edgeWidths);
+  *visitedNodes          = *(source.visitedNodes);
+  *cycles                = *(source.cycles);
+  roadWidths             = source.roadWidths;
+  extractInParallel      = source.extractInParallel;
 
   return *this;
 }
@@ -86,16 +179,154 @@ void AreaExtractor::copyVertices(StreetGraph* map, Zone* zone)
 {
   reset();
 
-  /* Add all nodes into adjacency list. */
-  StreetGraph::Intersections inputIntersections = map->getIntersections();
-  for (std::list<Intersection*>::iterator insertedIntersectionIterator = inputIntersections.begin();
-       insertedIntersectionIterator != inputIntersections.end();
-       insertedIntersectionIterator++)
+  /* Intersections and their neighbours are read from a compact
+     view of the graph, where they are already numbered. Only the
+     part inside of the zone is copied to the view. */
+  CompactStreetGraph* view = 0;
+  if (zone != 0)
+  {
+    StreetGraph::Intersections inputIntersections = map->getIntersections();
+    std::vector<Intersection*> intersections(inputIntersections.begin(), inputIntersections.end());
+
+    /* Classify all the intersections against the zone at once. */
+    std::vector<Point> positions;
+    positions.reserve(intersections.size());
+    for (std::vector<Intersection*>::iterator intersection = intersections.begin();
+         intersection != intersections.end();
+         intersection++)
+    {
+      positions.push_back((*intersection)->position());
+    }
+
+    PreparedPolygon preparedConstraints(zone->areaConstraints());
+    std::vector<bool> isInside;
+    preparedConstraints.enclosesBatch(positions, &isInside);
+
+    unsigned int kept = 0;
+    for (unsigned int position = 0; position < intersections.size(); position++)
+    {
+      if (isInside[position])
+      {
+        intersections[kept++] = intersections[position];
+      }
+    }
+    intersections.resize(kept);
+
+    view = new CompactStreetGraph(intersections);
+  }
+  else
   {
-    addVertex(*insertedIntersectionIterator, zone);
+    view = new CompactStreetGraph(map);
   }
+
+  CompactStreetGraph const& graph = *view;
+  int numberOfNodes = graph.numberOfIntersections();
+  std::vector<CompactStreetGraph::Index> order(numberOfNodes);
+  for (int intersection = 0; intersection < numberOfNodes; intersection++)
+  {
+    order[intersection] = intersection;
+  }
+
+  /* Cycles are walked from the left-most (and lowest) node. */
+  std::sort(order.begin(), order.end(), LeftAndLower(graph));
+
+  std::vector<int> numbers(numberOfNodes);
+  nodes->resize(numberOfNodes);
+  for (int node = 0; node < numberOfNodes; node++)
+  {
+    numbers[order[node]] = node;
+    (*nodes)[node] = graph.intersection(order[node]);
+  }
+
+  removedNodes->assign(numberOfNodes, false);
+  visitedNodes->assign(numberOfNodes, false);
+  numberOfRemainingNodes = numberOfNodes;
+  adjacencyStart->resize(numberOfNodes);
+  adjacencyCount->resize(numberOfNodes);
+
+  int numberOfEdges = 0;
+  std::vector<Neighbour> neighbours;
+  for (int node = 0; node < numberOfNodes; node++)
+  {
+    CompactStreetGraph::Index intersection = order[node];
+
+    neighbours.clear();
+    for (CompactStreetGraph::Index slot = graph.adjacencyBegin(intersection);
+         slot < graph.adjacencyEnd(intersection);
+         slot++)
+    {
+      neighbours.push_back(Neighbour(numbers[graph.neighbor(slot)],
+                                     graph.roadType(graph.adjacentRoad(slot))));
+    }
+
+    /* Sort them counter-clockwise, so the turns while
+       walking the cycles are just lookups. */
+    std::sort(neighbours.begin(), neighbours.end(),
+              CounterclockwiseOrder(graph.position(intersection), nodes));
+
+    (*adjacencyStart)[node] = adjacency->size();
+    (*adjacencyCount)[node] = 0;
+    for (unsigned int i = 0; i < neighbours.size(); i++)
+    {
+      appendNeighbour(node, neighbours[i].first, neighbours[i].second, &numberOfEdges);
+    }
+  }
+
+  cycleEdges->assign(numberOfEdges, false);
+  delete view;
 }
 
+void AreaExtractor::copyComponent(AreaExtractor const& whole, std::vector<int> const& members,
+                                  std::vector<int> const& numbers)
+{
+  reset();
+
+  int numberOfNodes = members.size();
+  nodes->resize(numberOfNodes);
+  removedNodes->assign(numberOfNodes, false);
+  visitedNodes->assign(numberOfNodes, false);
+  numberOfRemainingNodes = numberOfNodes;
+  adjacencyStart->resize(numberOfNodes);
+  adjacencyCount->resize(numberOfNodes);
+
+  /* Members are sorted, so the nodes stay in the order of positions
+     and their neighbours stay sorted counter-clockwise. */
+  int numberOfEdges = 0;
+  for (int node = 0; node < numberOfNodes; node++)
+  {
+    int member = members[node];
+    (*nodes)[node] = (*whole.nodes)[member];
+    (*adjacencyStart)[node] = adjacency->size();
+    (*adjacencyCount)[node] = 0;
+
+    int start = (*whole.adjacencyStart)[member];
+    for (int slot = 0; slot < (*whole.adjacencyCount)[member]; slot++)
+    {
+      appendNeighbour(node, numbers[(*whole.adjacency)[start + slot]],
+                      (*whole.edgeTypes)[(*whole.adjacencyEdges)[start + slot]], &numberOfEdges);
+    }
+  }
+
+  cycleEdges->assign(numberOfEdges, false);
+}
+
+void AreaExtractor::appendNeighbour(int node, int neighbour, Road::Type type, int* numberOfEdges)
+{
+  adjacency->push_back(neighbour);
+
+  /* Both ends of an edge share its number. */
+  if (neighbour > node)
+  {
+    adjacencyEdges->push_back((*numberOfEdges)++);
+    edgeTypes->push_back(type);
+  }
+  else
+  {
+    adjacencyEdges->push_back(edgeBetween(neighbour, node));
+  }
+
+  (*adjacencyCount)[node]++;
+}
 
 void AreaExtractor::setRoadWidth(Road::Type type, double width)
 {
@@ -107,6 +338,11 @@ void AreaExtractor::setRoadWidths(std::map<Road::Type, double> widths)
   roadWidths = widths;
 }
 
+void AreaExtractor::setParallel(bool parallel)
+{
+  extractInParallel = parallel;
+}
+
 std::list<Zone*> AreaExtractor::extractZones(StreetGraph* fromMap, Zone* zoneConstraints)
 {
   reset();
@@ -114,7 +350,14 @@ std::list<Zone*> AreaExtractor::extractZones(StreetGraph* fromMap, Zone* zoneCon
   copyVertices(map, zoneConstraints);
   substractRoadWidthFromAreas = false;
 
-  getMinimalCycles();
+  if (extractInParallel)
+  {
+    getMinimalCyclesByComponents();
+  }
+  else
+  {
+    getMinimalCycles();
+  }
 
   std::list<Zone*> zones;
   for (std::list<Polygon>::iterator foundZone = cycles->begin();
@@ -135,9 +378,18 @@ std::list<Block*> AreaExtractor::extractBlocks(StreetGraph* fromMap, Zone* zoneC
   map = fromMap;
   copyVertices(map, zoneConstraints);
   substractRoadWidthFromAreas = true;
+  assignEdgeWidths();
   std::list<Block*> blocks;
 
-  getMinimalCycles();
+  if (extractInParallel)
+  {
+    getMinimalCyclesByComponents();
+  }
+  else
+  {
+    getMinimalCycles();
+    substractRoadWidths();
+  }
 
   for (std::list<Polygon>::iterator foundZone = cycles->begin();
        foundZone != cycles->end();
@@ -150,21 +402,39 @@ std::list<Block*> AreaExtractor::extractBlocks(StreetGraph* fromMap, Zone* zoneC
   return blocks;
 }
 
-std::vector<double> AreaExtractor::getSubstractDistances(std::vector<Intersection*> intersections)
+void AreaExtractor::assignEdgeWidths()
 {
-  /* Get width of all edges */
-  std::vector<double> edgeWidth;
-  int current, next;
-  Road* road;
-  for (unsigned int i = 0; i < intersections.size(); i++)
+  double widest = 0;
+  for (std::map<Road::Type, double>::const_iterator width = roadWidths.begin();
+       width != roadWidths.end();
+       width++)
   {
-    current = i;
-    next = (i+1) % intersections.size();
+    widest = std::max(widest, width->second);
+  }
 
-    road  = map->getRoadBetweenIntersections(intersections[current], intersections[next]);
-    assert(roadWidths.find(road->type()) != roadWidths.end());
+  edgeWidths->resize(edgeTypes->size());
+  for (unsigned int edge = 0; edge < edgeTypes->size(); edge++)
+  {
+    std::map<Road::Type, double>::const_iterator width = roadWidths.find((*edgeTypes)[edge]);
+    if (width == roadWidths.end())
+    {
+      debug("AreaExtractor::assignEdgeWidths(): No width of road type " << (*edgeTypes)[edge] << ", using " << widest);
+      (*edgeWidths)[edge] = widest;
+    }
+    else
+    {
+      (*edgeWidths)[edge] = width->second;
+    }
+  }
+}
 
-    edgeWidth.push_back(roadWidths[road->type()]);
+std::vector<double> AreaExtractor::getSubstractDistances(std::vector<int> const& edges)
+{
+  /* Get width of all edges */
+  std::vector<double> edgeWidth(edges.size());
+  for (unsigned int i = 0; i < edges.size(); i++)
+  {
+    edgeWidth[i] = (*edgeWidths)[edges[i]];
   }
 
   return edgeWidth;
@@ -202,91 +472,155 @@ void AreaExtractor::minimalizeCycle(Polygon* minimalCycle, std::vector<double>*
   }
 }
 
-void AreaExtractor::substractRoadWidths(Polygon* minimalCycle, std::vector<double> const& distances)
+void AreaExtractor::substractRoadWidths()
 {
-  assert(minimalCycle->numberOfVertices() == distances.size());
-
-  Polygon oldArea(*minimalCycle);
-  int current, next, previous;
-  int vertices = minimalCycle->numberOfVertices();
-  Vector previousNormal, currentNormal;
-  Line previousEdge, currentEdge;
-  Point newVertex;
-
-  for(int i = 0; i < vertices; i++)
+  PolygonOffset offset;
+  for (unsigned int i = 0; i < pendingCycles->size(); i++)
   {
-    previous = (i-1) < 0 ? vertices-1 : i-1;
-    current = i;
-    next = (i + 1) % vertices;
+    Polygon& block = (*pendingCycles)[i];
 
-    previousNormal = oldArea.edgeNormal(previous);
-    currentNormal  = oldArea.edgeNormal(current);
-    previousNormal.normalize();
-    currentNormal.normalize();
-
-    previousEdge.setBegining(oldArea.vertex(current) + previousNormal*distances[previous]);
-    previousEdge.setEnd(oldArea.vertex(previous) + previousNormal*distances[previous]);
-
-    currentEdge.setBegining(oldArea.vertex(current) + currentNormal*distances[current]);
-    currentEdge.setEnd(oldArea.vertex(next) + currentNormal*distances[current]);
-
-    Line::Intersection result;
-    result = currentEdge.intersection2D(previousEdge, &newVertex);
-    if (result == Line::PARALLEL)
+    // Discard collapsed and wrong blocks
+    if (offset.offset(&block, (*pendingDistances)[i]) &&
+        block.isSubAreaOf((*pendingBoundaries)[i]))
     {
-      double distance = distances[previous];
-      if (distance < distances[current])
-      {
-        distance = distances[current];
-      }
-      newVertex = oldArea.vertex(current) + currentNormal*distance;
+      cycles->push_back(block);
     }
-
-    minimalCycle->updateVertex(current, newVertex);
   }
+
+  pendingCycles->clear();
+  pendingBoundaries->clear();
+  pendingDistances->clear();
 }
 
 void AreaExtractor::getMinimalCycles()
 {
-  std::vector<Intersection*> adjacentNodes;
-  Intersection* current;
-  Intersection* next;
+  int current;
 
   while (!empty())
   {
     current = first();
 
-    adjacentNodes = adjacent(current);
-
-    if (adjacentNodes.size() == 0)
+    if (numberOfAdjacentNodes(current) == 0)
     /* Isolated, no cycle possible. */
     {
       debug("AreaExtractor::getMinimalCycles(): Extracting isolated vertex.");
       extractIsolatedVertex(current);
     }
-    else if (adjacentNodes.size() == 1)
+    else if (numberOfAdjacentNodes(current) == 1)
     /* Remove filaments */
     {
       debug("AreaExtractor::getMinimalCycles(): Extracting filament.");
-      next = adjacentNodes[0];
-      extractFilament(current, next);
+      extractFilament(current, firstAdjacentNode(current));
     }
     else
     /* Extract cycles. */
     {
       debug("AreaExtractor::getMinimalCycles(): Extracting minimal cycle.");
-      next = adjacentNodes[0];
-      extractMinimalCycle(current, next);
+      extractMinimalCycle(current, firstAdjacentNode(current));
+    }
+  }
+}
+
+void AreaExtractor::getMinimalCyclesByComponents()
+{
+  std::vector< std::vector<int> > components;
+  findComponents(&components);
+
+  /* Nothing to run in parallel, don't pay for the copy. */
+  if (components.size() < 2)
+  {
+    getMinimalCycles();
+    substractRoadWidths();
+    return;
+  }
+
+  std::vector<int> numbers(nodes->size());
+  for (unsigned int component = 0; component < components.size(); component++)
+  {
+    for (unsigned int i = 0; i < components[component].size(); i++)
+    {
+      numbers[components[component][i]] = i;
+    }
+  }
+
+  int numberOfComponents = components.size();
+  std::vector<AreaExtractor*> extractors(numberOfComponents);
+  for (int component = 0; component < numberOfComponents; component++)
+  {
+    extractors[component] = new AreaExtractor();
+    extractors[component]->copyComponent(*this, components[component], numbers);
+    extractors[component]->map = map;
+    extractors[component]->roadWidths = roadWidths;
+    extractors[component]->substractRoadWidthFromAreas = substractRoadWidthFromAreas;
+    if (substractRoadWidthFromAreas)
+    {
+      extractors[component]->assignEdgeWidths();
+    }
+  }
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic)
+#endif
+  for (int component = 0; component < numberOfComponents; component++)
+  {
+    extractors[component]->getMinimalCycles();
+    extractors[component]->substractRoadWidths();
+  }
+
+  /* Merge in the order of components, not of finishing. */
+  for (int component = 0; component < numberOfComponents; component++)
+  {
+    cycles->splice(cycles->end(), *(extractors[component]->cycles));
+    delete extractors[component];
+  }
+}
+
+void AreaExtractor::findComponents(std::vector< std::vector<int> >* components)
+{
+  int numberOfNodes = nodes->size();
+  std::vector<bool> found(numberOfNodes, false);
+  std::vector<int> stack;
+
+  components->clear();
+  for (int first = 0; first < numberOfNodes; first++)
+  {
+    if (found[first])
+    {
+      continue;
+    }
+
+    components->push_back(std::vector<int>());
+    std::vector<int>& component = components->back();
+
+    found[first] = true;
+    stack.push_back(first);
+    while (!stack.empty())
+    {
+      int node = stack.back();
+      stack.pop_back();
+      component.push_back(node);
+
+      for (int i = 0; i < numberOfAdjacentNodes(node); i++)
+      {
+        int neighbour = adjacentNode(node, i);
+        if (!found[neighbour])
+        {
+          found[neighbour] = true;
+          stack.push_back(neighbour);
+        }
+      }
     }
+
+    std::sort(component.begin(), component.end());
   }
 }
 
-void AreaExtractor::extractIsolatedVertex(Intersection* vertex)
+void AreaExtractor::extractIsolatedVertex(int vertex)
 {
   removeVertex(vertex);
 }
 
-void AreaExtractor::extractFilament(Intersection* v0, Intersection* v1)
+void AreaExtractor::extractFilament(int v0, int v1)
 {
   if (isCycleEdge(v0,v1))
   {
@@ -347,30 +681,34 @@ void AreaExtractor::extractFilament(Intersection* v0, Intersection* v1)
   }
 }
 
-void AreaExtractor::extractMinimalCycle(Intersection* current, Intersection* next)
+void AreaExtractor::extractMinimalCycle(int current, int next)
 {
-  std::set<Intersection*> visited;
-  std::list<Intersection*> sequence;
+  std::vector<int> sequence;
 
   sequence.push_back(current);
-  next = getClockwiseMost(0, current);
+  next = getClockwiseMost(NO_NODE, current);
 
-  Intersection* previousVertex = current;
-  Intersection* currentVertex  = next;
-  Intersection* nextVertex  = 0;
-  while ((currentVertex != 0) &&
+  int previousVertex = current;
+  int currentVertex  = next;
+  int nextVertex  = NO_NODE;
+  while ((currentVertex != NO_NODE) &&
          (currentVertex != current) &&
-         (visited.find(currentVertex) == visited.end()))
+         !(*visitedNodes)[currentVertex])
   {
-    debug("AreaExtractor::extractMinimalCycle(): Next point in sequence is " << currentVertex->position().toString());
+    debug("AreaExtractor::extractMinimalCycle(): Next point in sequence is " << (*nodes)[currentVertex]->position().toString());
     sequence.push_back(currentVertex);
-    visited.insert(currentVertex);
+    (*visitedNodes)[currentVertex] = true;
     nextVertex = getCounterclockwiseMost(previousVertex, currentVertex);
     previousVertex = currentVertex;
     currentVertex = nextVertex;
   }
 
-  if (currentVertex == 0)
+  for (unsigned int i = 0; i < sequence.size(); i++)
+  {
+    (*visitedNodes)[sequence[i]] = false;
+  }
+
+  if (currentVertex == NO_NODE)
   {
     // Filament found, not necessarily rooted at v0.
     extractFilament(previousVertex,firstAdjacentNode(previousVertex));
@@ -379,39 +717,25 @@ void AreaExtractor::extractMinimalCycle(Intersection* current, Intersection* nex
   {
     // Minimal cycle found.
     Polygon minimalCycle;
-    std::vector<Intersection*> correspondingIntersections;
+    std::vector<int> edges;
 
-    for (std::list<Intersection*>::iterator nodeInCycle = sequence.begin();
-          nodeInCycle != sequence.end();
-          nodeInCycle++)
+    for (unsigned int i = 0; i < sequence.size(); i++)
     {
-      minimalCycle.addVertex((*nodeInCycle)->position());
-      correspondingIntersections.push_back(*nodeInCycle);
+      minimalCycle.addVertex((*nodes)[sequence[i]]->position());
 
-      std::list<Intersection*>::iterator nextNodeInCycle = nodeInCycle;
-      nextNodeInCycle++;
-      if (nextNodeInCycle == sequence.end())
       /* So we can mark the last edge */
-      {
-        nextNodeInCycle = sequence.begin();
-      }
-      markCycleEdge(*nodeInCycle, *nextNodeInCycle);
+      edges.push_back(edgeBetween(sequence[i], sequence[(i + 1) % sequence.size()]));
+      markCycleEdge(edges.back());
     }
 
     debug("AreaExtractor::extractMinimalCycle(): Storing minimal cycle.");
     if (substractRoadWidthFromAreas)
     {
-      std::vector<double> distances = getSubstractDistances(correspondingIntersections);
-      Polygon boundaries(minimalCycle);
+      std::vector<double> distances = getSubstractDistances(edges);
+      pendingBoundaries->push_back(minimalCycle);
       minimalizeCycle(&minimalCycle, &distances);
-      substractRoadWidths(&minimalCycle, distances);
-
-      // Discard wrong blocks
-      if (minimalCycle.isSubAreaOf(boundaries))
-      {
-        cycles->push_back(minimalCycle);
-      }
-        //cycles->push_back(minimalCycle);
+      pendingCycles->push_back(minimalCycle);
+      pendingDistances->push_back(distances);
     }
     else
     {
@@ -439,311 +763,196 @@ void AreaExtractor::extractMinimalCycle(Intersection* current, Intersection* nex
     // from the initial v1.
     while (numberOfAdjacentNodes(current) == 2)
     {
-      std::vector<Intersection*> adjacentNodes = adjacent(current);
-      if (adjacentNodes.front() != next)
+      if (adjacentNode(current, 0) != next)
       {
           next = current;
-          current = adjacentNodes.front();
+          current = adjacentNode(current, 0);
       }
       else
       {
           next = current;
-          current = adjacentNodes.back();
+          current = adjacentNode(current, 1);
       }
     }
     extractFilament(current,next);
   }
 }
 
-Intersection* AreaExtractor::getClockwiseMost(Intersection *previous, Intersection* current)
+int AreaExtractor::getClockwiseMost(int previous, int current)
 {
-  std::vector<Intersection*> adjacentNodes = adjacent(current);
-
-  Vector vCurrent = previous != 0 ? Vector(current->position(), previous->position()) : Vector(0, -1);
-  Vector vNext;
-  Intersection* next = 0;
-  double vCurrentIsConvex = false;
-
-  Intersection* adjacent = 0;
-  Vector vAdjacent(0,0,0);
-  for (std::vector<Intersection*>::iterator adjacentNode = adjacentNodes.begin();
-       adjacentNode != adjacentNodes.end();
-       adjacentNode++)
-  {
-    adjacent = *adjacentNode;
-
-    if (adjacent == previous)
-    {
-      continue;
-    }
-
-    vAdjacent.set(adjacent->position(), current->position());
-
-    if (!next)
-    {
-        next = adjacent;
-        vNext = vAdjacent;
-        vCurrentIsConvex = (vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON);
-        continue;
-    }
-
-    if (vCurrentIsConvex)
-    {
-      if (vCurrent.perpDotProduct(vAdjacent) < 0 || vNext.perpDotProduct(vAdjacent) < 0)
-      {
-          next = adjacent;
-          vNext = vAdjacent;
-          vCurrentIsConvex = vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON;
-      }
-    }
-    else
-    {
-      if (vCurrent.perpDotProduct(vAdjacent) < 0 && vNext.perpDotProduct(vAdjacent) < 0)
-      {
-          next = adjacent;
-          vNext = vAdjacent;
-          vCurrentIsConvex = vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON;
-      }
-    }
-  }
-
-  return next;
+  return getAdjacentAround(previous, current, 1);
 }
 
-Intersection* AreaExtractor::getCounterclockwiseMost(Intersection *previous, Intersection* current)
+int AreaExtractor::getCounterclockwiseMost(int previous, int current)
 {
-  std::vector<Intersection*> adjacentNodes = adjacent(current);
-
-  Vector vCurrent = previous ? Vector(current->position(), previous->position()) : Vector(0, -1);
-  Vector vNext;
-  Intersection* next = 0;
-  double vCurrentIsConvex = false;
+  return getAdjacentAround(previous, current, -1);
+}
 
-  Intersection* adjacent = 0;
-  Vector vAdjacent(0,0,0);
-  for (std::vector<Intersection*>::iterator adjacentNode = adjacentNodes.begin();
-       adjacentNode != adjacentNodes.end();
-       adjacentNode++)
+int AreaExtractor::getAdjacentAround(int previous, int current, int step)
+{
+  int const* sorted = &(*adjacency)[0] + (*adjacencyStart)[current];
+  int size = (*adjacencyCount)[current];
+  if (size == 0)
   {
-    adjacent = *adjacentNode;
-
-    if (adjacent == previous)
-    {
-      continue;
-    }
-
-    vAdjacent.set(adjacent->position(), current->position());
+    return NO_NODE;
+  }
 
-    if (!next)
+  if (previous == NO_NODE)
+  /* Coming from below, the way back points straight down. Nodes
+     right below it are sorted last, find the first of them. */
+  {
+    Point const& center = (*nodes)[current]->position();
+    int after = 0;
+    while (after < size && !((*nodes)[sorted[after]]->position().x() > center.x() &&
+                             (*nodes)[sorted[after]]->position().y() < center.y()))
     {
-        next = adjacent;
-        vNext = vAdjacent;
-        vCurrentIsConvex = (vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON);
-        continue;
+      after++;
     }
 
-    if (vCurrentIsConvex)
-    {
-      if (vCurrent.perpDotProduct(vAdjacent) > 0 && vNext.perpDotProduct(vAdjacent) > 0)
-      {
-          next = adjacent;
-          vNext = vAdjacent;
-          vCurrentIsConvex = vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON;
-      }
-    }
-    else
-    {
-      if (vCurrent.perpDotProduct(vAdjacent) > 0 || vNext.perpDotProduct(vAdjacent) > 0)
-      {
-          next = adjacent;
-          vNext = vAdjacent;
-          vCurrentIsConvex = vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON;
-      }
-    }
+    return step > 0 ? sorted[after % size] : sorted[(after + size - 1) % size];
   }
 
-  return next;
+  int position = edgeSlot(current, previous);
+  assert(position >= 0);
+
+  int next = sorted[(position + step + size) % size];
+  return next != previous ? next : NO_NODE;
 }
 
-int AreaExtractor::numberOfAdjacentNodes(Intersection* node)
+int AreaExtractor::numberOfAdjacentNodes(int node)
 {
-  return (*adjacentNodes)[node].size();
+  return (*adjacencyCount)[node];
 }
 
-void AreaExtractor::addVertex(Intersection* node, Zone* zone)
+int AreaExtractor::adjacentNode(int node, int number)
 {
-  std::vector<Intersection*> adjacent = node->adjacentIntersections();
-
-  if (zone != 0)
-  {
-    if (!zone->isIntersectionInside(node))
-    {
-      return;
-    }
+  assert(number < numberOfAdjacentNodes(node));
 
-    std::vector<Intersection*> adjacentNodesInZone;
-    for (unsigned int i = 0; i < adjacent.size(); i++)
-    {
-      if (zone->isIntersectionInside(adjacent[i]))
-      {
-        adjacentNodesInZone.push_back(adjacent[i]);
-      }
-    }
-    adjacent.clear();
-    adjacent.assign(adjacentNodesInZone.begin(), adjacentNodesInZone.end());
-  }
-
-
-  /* Insert adjacent intersections. */
-  adjacentNodes->insert(std::pair< Intersection*, std::vector<Intersection*> >(node, adjacent));
+  return (*adjacency)[(*adjacencyStart)[node] + number];
+}
 
-  std::list<Intersection*>::iterator sequenceIterator;
-  Intersection* existing;
+int AreaExtractor::edgeBetween(int begining, int end)
+{
+  int slot = edgeSlot(begining, end);
+  return slot >= 0 ? (*adjacencyEdges)[(*adjacencyStart)[begining] + slot] : -1;
+}
 
-  /* Determine where to sort current node. */
-  for (sequenceIterator  = vertices->begin();
-       sequenceIterator != vertices->end();
-       sequenceIterator++)
+int AreaExtractor::edgeSlot(int begining, int end)
+{
+  int start = (*adjacencyStart)[begining];
+  int count = (*adjacencyCount)[begining];
+  for (int slot = 0; slot < count; slot++)
   {
-    existing = *sequenceIterator;
-
-    if (node->position().x() < existing->position().x())
-    /* X coordinate of newly added intersection is smaller. Insert it before. */
-    {
-      break;
-    }
-    else if (node->position().x() == existing->position().x())
-    /* X coordinates are the same. Y will be used to decide. */
-    {
-      if (node->position().y() < existing->position().y())
-      /* Y of newly added intersection is smaller. Insert it before. */
-      {
-        break;
-      }
-      else
-      /* Y are greater or equal */
-      {
-        sequenceIterator++;
-        break;
-      }
-    }
-    else
-    /* Ckeck further points. */
+    if ((*adjacency)[start + slot] == end)
     {
-      continue;
+      return slot;
     }
   }
 
-  /* Insert into list. */
-  vertices->insert(sequenceIterator, node);
+  return -1;
 }
 
-void AreaExtractor::removeVertex(Intersection* node)
+void AreaExtractor::removeVertex(int node)
 {
-  vertices->remove(node);
-
-  for(std::vector<Intersection*>::iterator adjacentNode = (*adjacentNodes)[node].begin();
-      adjacentNode != (*adjacentNodes)[node].end();
-      adjacentNode++)
+  while (numberOfAdjacentNodes(node) > 0)
   {
-    removeEdge(node, *adjacentNode);
+    removeEdge(node, firstAdjacentNode(node));
   }
 
-  adjacentNodes->erase(node);
+  if (!(*removedNodes)[node])
+  {
+    (*removedNodes)[node] = true;
+    numberOfRemainingNodes--;
+  }
 }
 
-void AreaExtractor::removeEdge(Intersection* begining, Intersection* end)
+void AreaExtractor::removeEdge(int begining, int end)
 {
-  /* Remove second point from adjacency list of first point. */
-  for (std::vector<Intersection*>::iterator adjacentNode = (*adjacentNodes)[begining].begin();
-       adjacentNode != (*adjacentNodes)[begining].end();
-       adjacentNode++)
+  int slot = edgeSlot(begining, end);
+  if (slot < 0)
+  /* Already removed */
   {
-    if (*adjacentNode == end)
-    {
-      (*adjacentNodes)[begining].erase(adjacentNode);
-      break;
-    }
-  }
-
-  /* And vice versa. */
-  for (std::vector<Intersection*>::iterator adjacentNode = (*adjacentNodes)[end].begin();
-       adjacentNode != (*adjacentNodes)[end].end();
-       adjacentNode++)
-  {
-    if (*adjacentNode == begining)
-    {
-      (*adjacentNodes)[end].erase(adjacentNode);
-      break;
-    }
+    return;
   }
 
   /* If edge was marked as cycle edge, remove the mark as well. */
-  cycleEdges->erase(std::make_pair(begining, end));
-  cycleEdges->erase(std::make_pair(end, begining));
-}
+  (*cycleEdges)[(*adjacencyEdges)[(*adjacencyStart)[begining] + slot]] = false;
 
-Intersection* AreaExtractor::first()
-{
-  return vertices->front();
+  /* Remove each node from the other's neighbours, keeping
+     the rest of them in order. */
+  int ends[2] = {begining, end};
+  for (int i = 0; i < 2; i++)
+  {
+    int node = ends[i];
+    int start = (*adjacencyStart)[node];
+    int count = (*adjacencyCount)[node];
+
+    slot = edgeSlot(node, ends[1 - i]);
+    std::copy(adjacency->begin() + start + slot + 1, adjacency->begin() + start + count,
+              adjacency->begin() + start + slot);
+    std::copy(adjacencyEdges->begin() + start + slot + 1, adjacencyEdges->begin() + start + count,
+              adjacencyEdges->begin() + start + slot);
+    (*adjacencyCount)[node]--;
+  }
 }
 
-std::vector<Intersection*> AreaExtractor::adjacent(Intersection* node)
+int AreaExtractor::first()
 {
-  if (adjacentNodes->find(node) == adjacentNodes->end())
+  while ((*removedNodes)[firstRemainingNode])
   {
-    std::vector<Intersection*> empty;
-    // FIXME exception not in graph
-    return empty;
+    firstRemainingNode++;
   }
 
-  return (*adjacentNodes)[node];
+  return firstRemainingNode;
 }
 
 bool AreaExtractor::empty()
 {
-  return vertices->empty();
+  return numberOfRemainingNodes == 0;
 }
 
-Intersection* AreaExtractor::firstAdjacentNode(Intersection* node)
+int AreaExtractor::firstAdjacentNode(int node)
 {
   // FIXME throw exception when empty
   assert(numberOfAdjacentNodes(node) > 0);
 
-  return adjacent(node).front();
+  return adjacentNode(node, 0);
 }
 
-bool AreaExtractor::isCycleEdge(Intersection* begining, Intersection* end)
+bool AreaExtractor::isCycleEdge(int begining, int end)
 {
-  return cycleEdges->find(std::make_pair(begining, end)) != cycleEdges->end() ||
-         cycleEdges->find(std::make_pair(end, begining)) != cycleEdges->end();
+  int edge = edgeBetween(begining, end);
+  return edge >= 0 && (*cycleEdges)[edge];
 }
 
-void AreaExtractor::markCycleEdge(Intersection* begining, Intersection* end)
+void AreaExtractor::markCycleEdge(int edge)
 {
-  cycleEdges->insert(std::make_pair(begining, end));
+  assert(edge >= 0);
+
+  (*cycleEdges)[edge] = true;
 }
 
 void AreaExtractor::dumpAdjacencyLists()
 {
-  for (std::map< Intersection*, std::vector<Intersection*> >::iterator nodeIterator = adjacentNodes->begin();
-       nodeIterator != adjacentNodes->end();
-       nodeIterator++)
+  for (unsigned int node = 0; node < nodes->size(); node++)
   {
-    debug((*nodeIterator).first->position().toString() << " Has this adjacent nodes :");
-    for (std::vector<Intersection*>::iterator adjacentNodeIterator = (*nodeIterator).second.begin();
-         adjacentNodeIterator != (*nodeIterator).second.end();
-         adjacentNodeIterator++)
+    if ((*removedNodes)[node])
     {
-      debug("  " << (*adjacentNodeIterator)->position().toString());
+      continue;
+    }
+
+    debug((*nodes)[node]->position().toString() << " Has this adjacent nodes :");
+    for (int i = 0; i < numberOfAdjacentNodes(node); i++)
+    {
+      debug("  " << (*nodes)[adjacentNode(node, i)]->position().toString());
     }
   }
 }
 
 void AreaExtractor::dumpAdjacenciesFromVertices()
 {
-  for (std::list<Intersection*>::iterator nodeIterator = vertices->begin();
-       nodeIterator != vertices->end();
+  for (std::vector<Intersection*>::iterator nodeIterator = nodes->begin();
+       nodeIterator != nodes->end();
        nodeIterator++)
   {
     debug((*nodeIterator)->position().toString() << " Has this adjacent nodes :");
@@ -755,4 +964,4 @@ void AreaExtractor::dumpAdjacenciesFromVertices()
       debug("  " << (*adjacentNodeIterator)->position().toString());
     }
   }
-}
\ No newline at end of file
+}
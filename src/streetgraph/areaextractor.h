@@ -20,7 +20,6 @@
  */
 
 #include <list>
-#include <set>
 #include <map>
 #include <vector>
 
@@ -47,47 +46,144 @@ class AreaExtractor
     AreaExtractor(AreaExtractor const& source);
     AreaExtractor& operator=(AreaExtractor const& source);
 
+    /**
+      Set the widths of the roads substracted from the blocks.
+     @remarks
+       Roads of a type with no width set are taken as wide as
+       the widest road set, so that no block reaches over them.
+     */
     void setRoadWidth(Road::Type type, double width);
     void setRoadWidths(std::map<Road::Type, double> widths);
 
+    /**
+      Extract each connected part of the street graph on its own.
+     @remarks
+       The parts are independent, so they are extracted in parallel
+       when the library is built with OpenMP (make OPENMP_FLAGS=-fopenmp),
+       otherwise one after another. Areas are returned part by part, ordered by
+       the left-most intersection of each part, whatever the number
+       of threads. Off by default.
+
+       Each part is copied into its own extractor, so this only pays
+       off for graphs of many separate parts (e.g. districts that are
+       not connected yet). A single connected network, however large,
+       is extracted serially as if the mode was off.
+     @param[in] parallel Use the parallel mode.
+     */
+    void setParallel(bool parallel);
+
     std::list<Zone*> extractZones(StreetGraph* fromMap, Zone* zoneConstraints = 0);
     std::list<Block*> extractBlocks(StreetGraph* fromMap, Zone* zoneConstraints = 0);
 
   private:
-    Intersection* first(); /**< Get first node in sequence. */
+    /** No node, used when a walk has nowhere to come from or go to. */
+    static const int NO_NODE;
+
+    int first(); /**< Get first node in sequence. */
     bool empty(); /**< Is graph empty? */
 
     /**
      * Find all minimal cycles and return them as polygons.
      */
     void getMinimalCycles();
-    
+
+    /**
+     * Find the minimal cycles of each connected component in a separate
+     * extractor and merge the results in the order of the components.
+     * A graph of one component is processed in place.
+     */
+    void getMinimalCyclesByComponents();
+
+    /**
+     * Number the connected components of the graph.
+     * @param[out] components Nodes of each component, sorted. Components
+     *                        are sorted by their first nodes.
+     */
+    void findComponents(std::vector< std::vector<int> >* components);
+
     void minimalizeCycle(Polygon* minimalCycle, std::vector<double>* distances);
-    std::vector<double> getSubstractDistances(std::vector<Intersection*> intersections);
-    void substractRoadWidths(Polygon* minimalCycle, std::vector<double> const& distances);
+    /**
+     * Look up the width of each edge by the type of its road.
+     * Types with no width get the widest one (see setRoadWidth()).
+     */
+    void assignEdgeWidths();
 
+    /** Widths of the roads along the edges of a cycle. */
+    std::vector<double> getSubstractDistances(std::vector<int> const& edges);
+
+    /**
+     * Substract road widths from all the pending cycles at once
+     * and store the blocks that are still valid in cycles.
+     */
+    void substractRoadWidths();
+
+    /**
+     * Take a snapshot of the graph.
+     * @remarks
+     *   Nodes are numbered in the order of their (x, y) positions,
+     *   so the left-most node is always the first one not removed.
+     *   Neighbours of each node are sorted counter-clockwise.
+     * @param[in] map  Street graph.
+     * @param[in] zone If not 0, only the intersections in the
+     *                 zone are taken into account.
+     */
     void copyVertices(StreetGraph* map, Zone* zone = 0);
-    void addVertex(Intersection* node, Zone* zone = 0);
-    void removeVertex(Intersection* node);
+
+    /**
+     * Take a snapshot of a connected component of another snapshot.
+     * @param[in] whole   Snapshot of the whole graph.
+     * @param[in] members Nodes of the component in the whole graph, sorted.
+     * @param[in] numbers Number of each node of the whole graph in its component.
+     */
+    void copyComponent(AreaExtractor const& whole, std::vector<int> const& members,
+                       std::vector<int> const& numbers);
+
+    /**
+     * Add neighbour at the end of the last node's neighbours.
+     * @param[in]  node          Last node added.
+     * @param[in]  neighbour     Its neighbour.
+     * @param[in]  type          Type of the road between them.
+     * @param[out] numberOfEdges Number of edges so far, increased for new edges.
+     */
+    void appendNeighbour(int node, int neighbour, Road::Type type, int* numberOfEdges);
+
+    void removeVertex(int node);
 
     /* Adding edges not neccessary */
-    void removeEdge(Intersection* begining, Intersection* end);
+    void removeEdge(int begining, int end);
 
-    bool isCycleEdge(Intersection* begining, Intersection* end);
-    void markCycleEdge(Intersection* begining, Intersection* end);
+    bool isCycleEdge(int begining, int end);
+    void markCycleEdge(int edge);
 
     /* Extracting methods. */
-    void extractIsolatedVertex(Intersection* vertex);
-    void extractFilament(Intersection* current, Intersection* next);
-    void extractMinimalCycle(Intersection* current, Intersection* next);
+    void extractIsolatedVertex(int vertex);
+    void extractFilament(int current, int next);
+    void extractMinimalCycle(int current, int next);
 
-    Intersection* getClockwiseMost(Intersection* previous, Intersection* current);
-    Intersection* getCounterclockwiseMost(Intersection* previous, Intersection* current);
+    int getClockwiseMost(int previous, int current);
+    int getCounterclockwiseMost(int previous, int current);
+
+    /**
+     * Neighbour of current next to previous in the counter-clockwise
+     * order of the adjacent nodes.
+     * @param[in] previous Node the walk came from, NO_NODE when starting from below.
+     * @param[in] current  Node where the walk turns.
+     * @param[in] step     1 for the clockwise most turn, -1 for the
+     *                     counter-clockwise most one.
+     * @return Next node or NO_NODE if the walk can only go back.
+     */
+    int getAdjacentAround(int previous, int current, int step);
 
     /* Adjacent nodes access methods. */
-    int numberOfAdjacentNodes(Intersection* node);
-    std::vector<Intersection*> adjacent(Intersection* node);
-    Intersection* firstAdjacentNode(Intersection* node);
+    int numberOfAdjacentNodes(int node);
+    int adjacentNode(int node, int number);
+    int firstAdjacentNode(int node);
+
+    /** Number of the edge between the nodes, -1 if there is none. */
+    int edgeBetween(int begining, int end);
+
+    /** Position of the edge among the slots of begining, -1 if there is none. */
+    int edgeSlot(int begining, int end);
 
     void initialize();
     void reset();
@@ -97,19 +193,47 @@ class AreaExtractor
     void dumpAdjacenciesFromVertices();
 
   private:
-    /** Stores all vertices of the graph sorted by their x position. */
-    std::list<Intersection*>* vertices;
+    /** Intersections of the snapshot, the index is the number of the node. */
+    std::vector<Intersection*>* nodes;
 
-    /** Graph description. List of adjacent nodes to each node. */
-    std::map< Intersection*, std::vector<Intersection*> >* adjacentNodes;
+    /** Nodes already extracted from the graph. */
+    std::vector<bool>* removedNodes;
+    int firstRemainingNode;
+    int numberOfRemainingNodes;
+
+    /**
+     * Graph description. Neighbours of node i and the edges leading
+     * to them are stored in adjacency and adjacencyEdges, adjacencyCount[i]
+     * of them from adjacencyStart[i] on.
+     */
+    std::vector<int>* adjacencyStart;
+    std::vector<int>* adjacencyCount;
+    std::vector<int>* adjacency;
+    std::vector<int>* adjacencyEdges;
 
     /** Edges marked as a part of a cycle. */
-    std::set< std::pair<Intersection*, Intersection*> > *cycleEdges;
+    std::vector<bool>* cycleEdges;
+
+    /** Type of the road along each edge, taken with the snapshot. */
+    std::vector<Road::Type>* edgeTypes;
+
+    /** Width of the road along each edge when extracting blocks. */
+    std::vector<double>* edgeWidths;
+
+    /** Nodes visited by the current cycle walk. */
+    std::vector<bool>* visitedNodes;
 
     std::map<Road::Type, double> roadWidths;
     bool substractRoadWidthFromAreas;
+    bool extractInParallel;
 
     StreetGraph* map;
 
     std::list<Polygon>* cycles;
+
+    /** Minimal cycles waiting for substraction of road widths,
+        their original borders and the width of each edge. */
+    std::vector<Polygon>* pendingCycles;
+    std::vector<Polygon>* pendingBoundaries;
+    std::vector< std::vector<double> >* pendingDistances;
 };
\ No newline at end of file
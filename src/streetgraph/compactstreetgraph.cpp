@@ -0,0 +1,190 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/compactstreetgraph.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see compactstreetgraph.h
+ *
+ */
+
+#include "compactstreetgraph.h"
+#include "streetgraph.h"
+#include "intersection.h"
+#include "road.h"
+#include "../geometry/point.h"
+#include "../debug.h"
+
+#include <algorithm>
+#include <list>
+
+CompactStreetGraph::CompactStreetGraph(StreetGraph* graph)
+{
+  initialize();
+  build(graph);
+}
+
+CompactStreetGraph::CompactStreetGraph(std::vector<Intersection*> const& intersections)
+{
+  initialize();
+  build(intersections);
+}
+
+void CompactStreetGraph::initialize()
+{
+  xCoordinates = new std::vector<double>;
+  yCoordinates = new std::vector<double>;
+
+  offsets = new std::vector<Index>;
+  neighbors = new std::vector<Index>;
+  adjacentRoads = new std::vector<Index>;
+
+  roadBeginings = new std::vector<Index>;
+  roadEnds = new std::vector<Index>;
+  roadTypes = new std::vector<Road::Type>;
+
+  sourceIntersections = new std::vector<Intersection*>;
+  sourceRoads = new std::vector<Road*>;
+}
+
+CompactStreetGraph::~CompactStreetGraph()
+{
+  freeMemory();
+}
+
+void CompactStreetGraph::freeMemory()
+{
+  delete xCoordinates;
+  delete yCoordinates;
+
+  delete offsets;
+  delete neighbors;
+  delete adjacentRoads;
+
+  delete roadBeginings;
+  delete roadEnds;
+  delete roadTypes;
+
+  delete sourceIntersections;
+  delete sourceRoads;
+}
+
+Point CompactStreetGraph::position(Index intersection) const
+{
+  return Point((*xCoordinates)[intersection], (*yCoordinates)[intersection]);
+}
+
+void CompactStreetGraph::addIntersections(std::vector<Intersection*> const& intersections,
+                                          std::vector< std::pair<Intersection*, Index> >* numbers)
+{
+  numbers->reserve(intersections.size());
+  xCoordinates->reserve(intersections.size());
+  yCoordinates->reserve(intersections.size());
+  sourceIntersections->reserve(intersections.size());
+  for (std::vector<Intersection*>::const_iterator intersection = intersections.begin();
+       intersection != intersections.end();
+       intersection++)
+  {
+    Point position = (*intersection)->position();
+    numbers->push_back(std::make_pair(*intersection, static_cast<Index>(sourceIntersections->size())));
+    sourceIntersections->push_back(*intersection);
+    xCoordinates->push_back(position.x());
+    yCoordinates->push_back(position.y());
+  }
+
+  /* Numbers are found by binary search, no node is allocated
+     per intersection. */
+  std::sort(numbers->begin(), numbers->end());
+}
+
+void CompactStreetGraph::addRoad(Road* road, Index begining, Index end)
+{
+  sourceRoads->push_back(road);
+  roadBeginings->push_back(begining);
+  roadEnds->push_back(end);
+  roadTypes->push_back(road->type());
+}
+
+void CompactStreetGraph::build(StreetGraph* graph)
+{
+  StreetGraph::Intersections intersections = graph->getIntersections();
+  std::vector< std::pair<Intersection*, Index> > numbers;
+  addIntersections(std::vector<Intersection*>(intersections.begin(), intersections.end()), &numbers);
+
+  for (StreetGraph::iterator road = graph->begin();
+       road != graph->end();
+       road++)
+  {
+    addRoad(*road,
+            std::lower_bound(numbers.begin(), numbers.end(),
+                             std::make_pair((*road)->begining(), Index(0)))->second,
+            std::lower_bound(numbers.begin(), numbers.end(),
+                             std::make_pair((*road)->end(), Index(0)))->second);
+  }
+
+  buildAdjacency();
+}
+
+void CompactStreetGraph::build(std::vector<Intersection*> const& intersections)
+{
+  std::vector< std::pair<Intersection*, Index> > numbers;
+  addIntersections(intersections, &numbers);
+
+  /* Each road inside the part is added from its begining. */
+  for (Index intersection = 0; intersection < sourceIntersections->size(); intersection++)
+  {
+    Intersection* source = (*sourceIntersections)[intersection];
+    std::list<Road*> roads = source->getRoads();
+    for (std::list<Road*>::iterator road = roads.begin();
+         road != roads.end();
+         road++)
+    {
+      if ((*road)->begining() != source)
+      {
+        continue;
+      }
+
+      std::vector< std::pair<Intersection*, Index> >::iterator end =
+        std::lower_bound(numbers.begin(), numbers.end(), std::make_pair((*road)->end(), Index(0)));
+      if (end != numbers.end() && end->first == (*road)->end())
+      {
+        addRoad(*road, intersection, end->second);
+      }
+    }
+  }
+
+  buildAdjacency();
+}
+
+void CompactStreetGraph::buildAdjacency()
+{
+  /* Count the degrees, turn them to offsets and let both ends
+     of each road fill their next free adjacency. */
+  Index numberOfNodes = sourceIntersections->size();
+  offsets->assign(numberOfNodes + 1, 0);
+  for (Index road = 0; road < sourceRoads->size(); road++)
+  {
+    (*offsets)[(*roadBeginings)[road] + 1]++;
+    (*offsets)[(*roadEnds)[road] + 1]++;
+  }
+
+  for (Index intersection = 0; intersection < numberOfNodes; intersection++)
+  {
+    (*offsets)[intersection + 1] += (*offsets)[intersection];
+  }
+
+  std::vector<Index> next(offsets->begin(), offsets->end() - 1);
+  neighbors->resize(offsets->back());
+  adjacentRoads->resize(offsets->back());
+  for (Index road = 0; road < sourceRoads->size(); road++)
+  {
+    Index begining = (*roadBeginings)[road];
+    Index end = (*roadEnds)[road];
+
+    (*neighbors)[next[begining]] = end;
+    (*adjacentRoads)[next[begining]++] = road;
+    (*neighbors)[next[end]] = begining;
+    (*adjacentRoads)[next[end]++] = road;
+  }
+}
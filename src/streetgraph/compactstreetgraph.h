@@ -0,0 +1,196 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/compactstreetgraph.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Frozen compressed sparse row view of a StreetGraph.
+ *
+ * Intersections and roads are numbered from zero. Positions
+ * of the intersections are stored in two contiguous arrays of
+ * coordinates. Roads leading from intersection i are found
+ * in neighbors and adjacentRoads between offsets[i] and
+ * offsets[i + 1], in the order of the roads of the view.
+ * A view of the whole graph is built from its list of roads,
+ * lists of the roads of each intersection are walked only
+ * for a view of a part of the graph.
+ *
+ * AreaExtractor reads the graph through this view.
+ *
+ * The view is not updated when the source graph changes,
+ * build a new one instead.
+ *
+ */
+
+#ifndef _COMPACTSTREETGRAPH_H_
+#define _COMPACTSTREETGRAPH_H_
+
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#include "road.h"
+
+class StreetGraph;
+class Intersection;
+class Point;
+
+class CompactStreetGraph
+{
+  public:
+    typedef uint32_t Index;
+
+    /**
+      Build the view of the current state of a street graph.
+     @param[in] graph Source graph.
+     */
+    CompactStreetGraph(StreetGraph* graph);
+
+    /**
+      Build the view of a part of a street graph.
+     @remarks
+       Only the roads between two of the intersections are
+       in the view, roads leading out of the part are left out.
+     @param[in] intersections Intersections of the part, each one once.
+     */
+    CompactStreetGraph(std::vector<Intersection*> const& intersections);
+    ~CompactStreetGraph();
+
+    Index numberOfIntersections() const;
+    Index numberOfRoads() const;
+
+    /** @{ */
+    /** Position of an intersection. */
+    double x(Index intersection) const;
+    double y(Index intersection) const;
+    Point position(Index intersection) const;
+    /** @} */
+
+    /** @{ */
+    /**
+      Range of adjacencies of an intersection. Use
+      neighbor() and adjacentRoad() to read them.
+     */
+    Index adjacencyBegin(Index intersection) const;
+    Index adjacencyEnd(Index intersection) const;
+    Index degree(Index intersection) const;
+    /** @} */
+
+    Index neighbor(Index adjacency) const;     /**< Intersection on the other end */
+    Index adjacentRoad(Index adjacency) const; /**< Road leading there */
+
+    Index roadBegining(Index road) const;
+    Index roadEnd(Index road) const;
+    Road::Type roadType(Index road) const;
+
+    /** @{ */
+    /** Objects of the source graph. */
+    Intersection* intersection(Index intersection) const;
+    Road* road(Index road) const;
+    /** @} */
+
+  private: /* Copying not allowed */
+    CompactStreetGraph(CompactStreetGraph const& source);
+    CompactStreetGraph& operator=(CompactStreetGraph const& source);
+
+  private:
+    std::vector<double>* xCoordinates;
+    std::vector<double>* yCoordinates;
+
+    std::vector<Index>* offsets;
+    std::vector<Index>* neighbors;
+    std::vector<Index>* adjacentRoads;
+
+    std::vector<Index>* roadBeginings;
+    std::vector<Index>* roadEnds;
+    std::vector<Road::Type>* roadTypes;
+
+    std::vector<Intersection*>* sourceIntersections;
+    std::vector<Road*>* sourceRoads;
+
+    void build(StreetGraph* graph);
+    void build(std::vector<Intersection*> const& intersections);
+
+    /** Store the intersections and sort their numbers for lookups. */
+    void addIntersections(std::vector<Intersection*> const& intersections,
+                          std::vector< std::pair<Intersection*, Index> >* numbers);
+    void addRoad(Road* road, Index begining, Index end);
+    void buildAdjacency();
+
+    void initialize();
+    void freeMemory();
+};
+
+/* Inlines */
+inline CompactStreetGraph::Index CompactStreetGraph::numberOfIntersections() const
+{
+  return xCoordinates->size();
+}
+
+inline CompactStreetGraph::Index CompactStreetGraph::numberOfRoads() const
+{
+  return roadTypes->size();
+}
+
+inline double CompactStreetGraph::x(Index intersection) const
+{
+  return (*xCoordinates)[intersection];
+}
+
+inline double CompactStreetGraph::y(Index intersection) const
+{
+  return (*yCoordinates)[intersection];
+}
+
+inline CompactStreetGraph::Index CompactStreetGraph::adjacencyBegin(Index intersection) const
+{
+  return (*offsets)[intersection];
+}
+
+inline CompactStreetGraph::Index CompactStreetGraph::adjacencyEnd(Index intersection) const
+{
+  return (*offsets)[intersection + 1];
+}
+
+inline CompactStreetGraph::Index CompactStreetGraph::degree(Index intersection) const
+{
+  return (*offsets)[intersection + 1] - (*offsets)[intersection];
+}
+
+inline CompactStreetGraph::Index CompactStreetGraph::neighbor(Index adjacency) const
+{
+  return (*neighbors)[adjacency];
+}
+
+inline CompactStreetGraph::Index CompactStreetGraph::adjacentRoad(Index adjacency) const
+{
+  return (*adjacentRoads)[adjacency];
+}
+
+inline CompactStreetGraph::Index CompactStreetGraph::roadBegining(Index road) const
+{
+  return (*roadBeginings)[road];
+}
+
+inline CompactStreetGraph::Index CompactStreetGraph::roadEnd(Index road) const
+{
+  return (*roadEnds)[road];
+}
+
+inline Road::Type CompactStreetGraph::roadType(Index road) const
+{
+  return (*roadTypes)[road];
+}
+
+inline Intersection* CompactStreetGraph::intersection(Index intersection) const
+{
+  return (*sourceIntersections)[intersection];
+}
+
+inline Road* CompactStreetGraph::road(Index road) const
+{
+  return (*sourceRoads)[road];
+}
+
+#endif
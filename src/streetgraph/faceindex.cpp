@@ -0,0 +1,372 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/faceindex.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see faceindex.h
+ *
+ */
+
+#include "faceindex.h"
+#include "intersection.h"
+#include "road.h"
+#include "../geometry/point.h"
+#include "../geometry/polygon.h"
+#include "../geometry/predicates.h"
+#include "../debug.h"
+
+const FaceIndex::Face FaceIndex::NO_FACE = 0;
+
+FaceIndex::FaceIndex()
+{
+  initialize();
+}
+
+FaceIndex::~FaceIndex()
+{
+  freeMemory();
+}
+
+void FaceIndex::initialize()
+{
+  halfEdges = new std::vector<HalfEdge>;
+  unusedHalfEdges = new std::vector<int>;
+  outgoing = new std::map< Intersection*, std::vector<int> >;
+  roadHalfEdges = new std::map<Road*, int>;
+  faceHalfEdges = new std::map<Face, int>;
+  createdFaces = new std::set<Face>;
+  destroyedFaces = new std::set<Face>;
+  lastFace = NO_FACE;
+}
+
+void FaceIndex::freeMemory()
+{
+  delete halfEdges;
+  delete unusedHalfEdges;
+  delete outgoing;
+  delete roadHalfEdges;
+  delete faceHalfEdges;
+  delete createdFaces;
+  delete destroyedFaces;
+}
+
+void FaceIndex::clear()
+{
+  halfEdges->clear();
+  unusedHalfEdges->clear();
+  outgoing->clear();
+  roadHalfEdges->clear();
+  faceHalfEdges->clear();
+  createdFaces->clear();
+  destroyedFaces->clear();
+}
+
+void FaceIndex::build(std::vector<Road*> const& roads)
+{
+  clear();
+
+  for (std::vector<Road*>::const_iterator road = roads.begin();
+       road != roads.end();
+       road++)
+  {
+    assert((*road)->begining() != (*road)->end());
+
+    int forward = createHalfEdge((*road)->begining(), (*road)->end());
+    int backward = createHalfEdge((*road)->end(), (*road)->begining());
+    (*halfEdges)[forward].twin = backward;
+    (*halfEdges)[backward].twin = forward;
+    (*roadHalfEdges)[*road] = forward;
+  }
+
+  for (unsigned int halfEdge = 0; halfEdge < halfEdges->size(); halfEdge++)
+  {
+    if ((*halfEdges)[halfEdge].face == NO_FACE)
+    {
+      traceFace(halfEdge);
+    }
+  }
+}
+
+void FaceIndex::insert(Road* road)
+{
+  Intersection* ends[2] = {road->begining(), road->end()};
+  assert(ends[0] != ends[1]);
+  assert(roadHalfEdges->find(road) == roadHalfEdges->end());
+
+  /* The faces going through the gaps where the new
+     half-edges fit will change. */
+  for (int end = 0; end < 2; end++)
+  {
+    std::map< Intersection*, std::vector<int> >::iterator leaving = outgoing->find(ends[end]);
+    if (leaving == outgoing->end())
+    {
+      continue;
+    }
+
+    std::vector<int> const& sorted = leaving->second;
+    int following = sorted.front();
+    for (unsigned int i = 0; i < sorted.size(); i++)
+    {
+      if (isBefore(ends[end], ends[1 - end], (*halfEdges)[sorted[i]].target))
+      {
+        following = sorted[i];
+        break;
+      }
+    }
+
+    destroyFace((*halfEdges)[(*halfEdges)[following].twin].face);
+  }
+
+  int forward = createHalfEdge(ends[0], ends[1]);
+  int backward = createHalfEdge(ends[1], ends[0]);
+  (*halfEdges)[forward].twin = backward;
+  (*halfEdges)[backward].twin = forward;
+  (*roadHalfEdges)[road] = forward;
+
+  traceFace(forward);
+  if ((*halfEdges)[backward].face == NO_FACE)
+  {
+    traceFace(backward);
+  }
+}
+
+void FaceIndex::remove(Road* road)
+{
+  std::map<Road*, int>::iterator indexed = roadHalfEdges->find(road);
+  if (indexed == roadHalfEdges->end())
+  {
+    return;
+  }
+
+  int forward = indexed->second;
+  int backward = (*halfEdges)[forward].twin;
+  roadHalfEdges->erase(indexed);
+
+  /* Half-edges that will be followed by something else. */
+  int beforeForward = previous(forward);
+  int beforeBackward = previous(backward);
+
+  std::set<Face> stale;
+  stale.insert((*halfEdges)[forward].face);
+  stale.insert((*halfEdges)[backward].face);
+  for (std::set<Face>::iterator face = stale.begin(); face != stale.end(); face++)
+  {
+    destroyFace(*face);
+  }
+
+  releaseHalfEdge(forward);
+  releaseHalfEdge(backward);
+
+  int before[2] = {beforeForward, beforeBackward};
+  for (int i = 0; i < 2; i++)
+  {
+    if (before[i] != forward && before[i] != backward &&
+        stale.find((*halfEdges)[before[i]].face) != stale.end())
+    {
+      traceFace(before[i]);
+    }
+  }
+}
+
+std::vector<FaceIndex::Face> FaceIndex::faces() const
+{
+  std::vector<Face> current;
+  current.reserve(faceHalfEdges->size());
+  for (std::map<Face, int>::const_iterator face = faceHalfEdges->begin();
+       face != faceHalfEdges->end();
+       face++)
+  {
+    current.push_back(face->first);
+  }
+
+  return current;
+}
+
+void FaceIndex::areas(Face face, std::vector<Polygon>* areas) const
+{
+  std::map<Face, int>::const_iterator start = faceHalfEdges->find(face);
+  if (start == faceHalfEdges->end())
+  {
+    return;
+  }
+
+  /* Half-edges separating this face from another one. */
+  std::vector<int> border;
+  int current = start->second;
+  do
+  {
+    if ((*halfEdges)[(*halfEdges)[current].twin].face != face)
+    {
+      border.push_back(current);
+    }
+    current = next(current);
+  } while (current != start->second);
+
+  std::set<int> visited;
+  for (std::vector<int>::iterator first = border.begin(); first != border.end(); first++)
+  {
+    if (visited.find(*first) != visited.end())
+    {
+      continue;
+    }
+
+    Polygon area;
+    current = *first;
+    do
+    {
+      visited.insert(current);
+      area.addVertex((*halfEdges)[current].origin->position());
+
+      /* Turn clockwise past the filaments and bridges. */
+      std::vector<int> const& leaving = outgoing->find((*halfEdges)[current].target)->second;
+      int position = outgoingPosition((*halfEdges)[current].twin);
+      int candidate;
+      do
+      {
+        position = (position + leaving.size() - 1) % leaving.size();
+        candidate = leaving[position];
+      } while ((*halfEdges)[candidate].face != face ||
+               (*halfEdges)[(*halfEdges)[candidate].twin].face == face);
+
+      current = candidate;
+    } while (current != *first && area.numberOfVertices() <= border.size());
+
+    if (area.numberOfVertices() >= 3 && area.isCounterclockwise() && area.area() > 0)
+    {
+      areas->push_back(area);
+    }
+  }
+}
+
+void FaceIndex::takeChanges(std::vector<Face>* created, std::vector<Face>* destroyed)
+{
+  created->assign(createdFaces->begin(), createdFaces->end());
+  destroyed->assign(destroyedFaces->begin(), destroyedFaces->end());
+
+  createdFaces->clear();
+  destroyedFaces->clear();
+}
+
+bool FaceIndex::isBefore(Intersection* origin, Intersection* first, Intersection* second) const
+{
+  Point center = origin->position();
+  Point firstPosition = first->position();
+  Point secondPosition = second->position();
+
+  return libcity::isCounterclockwiseBefore(center.x(), center.y(),
+                                           firstPosition.x(), firstPosition.y(),
+                                           secondPosition.x(), secondPosition.y());
+}
+
+int FaceIndex::outgoingPosition(int halfEdge) const
+{
+  std::vector<int> const& leaving = outgoing->find((*halfEdges)[halfEdge].origin)->second;
+  for (unsigned int i = 0; i < leaving.size(); i++)
+  {
+    if (leaving[i] == halfEdge)
+    {
+      return i;
+    }
+  }
+
+  assert(false);
+  return -1;
+}
+
+int FaceIndex::next(int halfEdge) const
+{
+  /* Face is on the left, so turn to the nearest
+     half-edge clockwise from the way back. */
+  int twin = (*halfEdges)[halfEdge].twin;
+  std::vector<int> const& leaving = outgoing->find((*halfEdges)[twin].origin)->second;
+  int position = outgoingPosition(twin);
+
+  return leaving[(position + leaving.size() - 1) % leaving.size()];
+}
+
+int FaceIndex::previous(int halfEdge) const
+{
+  std::vector<int> const& leaving = outgoing->find((*halfEdges)[halfEdge].origin)->second;
+  int position = outgoingPosition(halfEdge);
+
+  return (*halfEdges)[leaving[(position + 1) % leaving.size()]].twin;
+}
+
+int FaceIndex::createHalfEdge(Intersection* origin, Intersection* target)
+{
+  int index;
+  if (unusedHalfEdges->empty())
+  {
+    index = halfEdges->size();
+    halfEdges->push_back(HalfEdge());
+  }
+  else
+  {
+    index = unusedHalfEdges->back();
+    unusedHalfEdges->pop_back();
+  }
+
+  HalfEdge& created = (*halfEdges)[index];
+  created.origin = origin;
+  created.target = target;
+  created.twin = -1;
+  created.face = NO_FACE;
+
+  std::vector<int>& leaving = (*outgoing)[origin];
+  std::vector<int>::iterator position = leaving.begin();
+  while (position != leaving.end() && !isBefore(origin, target, (*halfEdges)[*position].target))
+  {
+    position++;
+  }
+  leaving.insert(position, index);
+
+  return index;
+}
+
+void FaceIndex::releaseHalfEdge(int halfEdge)
+{
+  std::map< Intersection*, std::vector<int> >::iterator leaving =
+    outgoing->find((*halfEdges)[halfEdge].origin);
+
+  leaving->second.erase(leaving->second.begin() + outgoingPosition(halfEdge));
+  if (leaving->second.empty())
+  {
+    outgoing->erase(leaving);
+  }
+
+  (*halfEdges)[halfEdge].origin = 0;
+  (*halfEdges)[halfEdge].target = 0;
+  (*halfEdges)[halfEdge].face = NO_FACE;
+  unusedHalfEdges->push_back(halfEdge);
+}
+
+void FaceIndex::destroyFace(Face face)
+{
+  if (faceHalfEdges->erase(face) == 0)
+  /* No such face or already destroyed */
+  {
+    return;
+  }
+
+  if (createdFaces->erase(face) == 0)
+  {
+    destroyedFaces->insert(face);
+  }
+}
+
+void FaceIndex::traceFace(int start)
+{
+  Face face = ++lastFace;
+
+  int current = start;
+  do
+  {
+    (*halfEdges)[current].face = face;
+    current = next(current);
+  } while (current != start);
+
+  (*faceHalfEdges)[face] = start;
+  createdFaces->insert(face);
+}
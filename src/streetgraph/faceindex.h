@@ -0,0 +1,159 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/faceindex.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Faces of the planar street graph kept up to date.
+ *
+ * Every road is stored as two half-edges, one in each
+ * direction. Half-edges leaving an intersection are sorted
+ * counter-clockwise, so the half-edge following another one
+ * along a face is found by a turn at the intersection.
+ *
+ * Each half-edge knows the face on its left. Inserting or
+ * removing a road destroys the faces around the road and
+ * traces them again, so the cost is proportional to the
+ * size of those faces. That includes the outer face, which
+ * runs along the whole border of the graph, so building a
+ * large graph road by road is quadratic. Such graphs are
+ * indexed at once with build(), which traces every face
+ * only once. Created and destroyed faces are recorded for
+ * the users who need to update their areas after an edit.
+ *
+ */
+
+#ifndef _FACEINDEX_H_
+#define _FACEINDEX_H_
+
+#include <map>
+#include <set>
+#include <vector>
+
+class Intersection;
+class Road;
+class Polygon;
+
+class FaceIndex
+{
+  public:
+    /** Faces are numbered from 1, a number is never used twice. */
+    typedef unsigned long Face;
+
+    FaceIndex();
+    ~FaceIndex();
+
+    /**
+      Add road into the structure.
+     @remarks
+       Both intersections of the road must be already set
+       and the road must not cross any other indexed road.
+     @param[in] road Road to be indexed.
+     */
+    void insert(Road* road);
+
+    /**
+      Remove road from the structure.
+     @remarks
+       Must be called before the intersections of the road
+       change, the road remembers its old ends here.
+     @param[in] road Previously inserted road.
+     */
+    void remove(Road* road);
+
+    /**
+      Index all the roads at once.
+     @remarks
+       The previous content is dropped. All half-edges are
+       created first and then every face is traced once, so
+       it takes linear time (apart from sorting the roads at
+       each intersection). All the faces are reported as
+       created by the next takeChanges().
+     @param[in] roads Roads of a planar graph.
+     */
+    void build(std::vector<Road*> const& roads);
+
+    void clear();
+
+    /** All current faces in the order of creation. */
+    std::vector<Face> faces() const;
+
+    /**
+      Closed areas of a face.
+     @remarks
+       Roads that have the face on both sides (filaments and
+       bridges) are left out. Only the counter-clockwise borders
+       are areas, the outer face and holes have no area.
+     @param[in]  face  Current face.
+     @param[out] areas Borders of the areas are appended here.
+     */
+    void areas(Face face, std::vector<Polygon>* areas) const;
+
+    /**
+      Get faces created and destroyed since the last call.
+     @remarks
+       Faces that were created and destroyed again meanwhile
+       are not reported at all.
+     @param[out] created   Created faces, the vector is replaced.
+     @param[out] destroyed Destroyed faces, the vector is replaced.
+     */
+    void takeChanges(std::vector<Face>* created, std::vector<Face>* destroyed);
+
+  private: /* Copying not allowed */
+    FaceIndex(FaceIndex const& source);
+    FaceIndex& operator=(FaceIndex const& source);
+
+  private:
+    static const Face NO_FACE;
+
+    struct HalfEdge
+    {
+      Intersection* origin;
+      Intersection* target;
+      int twin;
+      Face face; /**< Face on the left side */
+    };
+
+    std::vector<HalfEdge>* halfEdges;
+    std::vector<int>* unusedHalfEdges;
+
+    /** Half-edges leaving each intersection, counter-clockwise. */
+    std::map< Intersection*, std::vector<int> >* outgoing;
+
+    /** Half-edge going from the begining to the end of each road. */
+    std::map<Road*, int>* roadHalfEdges;
+
+    /** Some half-edge on each face. */
+    std::map<Face, int>* faceHalfEdges;
+    Face lastFace;
+
+    std::set<Face>* createdFaces;
+    std::set<Face>* destroyedFaces;
+
+    /**
+      Is the first half-edge before the second one when going
+      counter-clockwise around their common origin?
+     */
+    bool isBefore(Intersection* origin, Intersection* first, Intersection* second) const;
+
+    /** Position of the half-edge among the ones leaving its origin. */
+    int outgoingPosition(int halfEdge) const;
+
+    /** Following half-edge along the face. */
+    int next(int halfEdge) const;
+
+    /** Half-edge ending at the intersection and followed by the given one. */
+    int previous(int halfEdge) const;
+
+    int createHalfEdge(Intersection* origin, Intersection* target);
+    void releaseHalfEdge(int halfEdge);
+
+    void destroyFace(Face face);
+    void traceFace(int start);
+
+    void initialize();
+    void freeMemory();
+};
+
+#endif
@@ -15,28 +15,17 @@
 #include "../geometry/point.h"
 
 Intersection::Intersection()
-  : roads(0), geometrical_position(0)
+  : firstRoad(0), ways(0)
 {
 }
 
 Intersection::Intersection(Point coordinates)
-  : roads(0), geometrical_position(0)
+  : firstRoad(0), ways(0), geometrical_position(coordinates)
 {
-  geometrical_position = new Point(coordinates);
-  roads = new std::list<Road*>;
 }
 
 Intersection::~Intersection()
 {
-  if (geometrical_position != 0)
-  {
-    delete geometrical_position;
-  }
-
-  if (roads != 0)
-  {
-    delete roads;
-  }
 }
 
 std::vector<Intersection*> Intersection::adjacentIntersections()
@@ -44,17 +33,15 @@ std::vector<Intersection*> Intersection::adjacentIntersections()
   std::vector<Intersection*> adjacent;
   adjacent.clear();
 
-  for (std::list<Road*>::iterator adjacentRoadIterator = roads->begin();
-       adjacentRoadIterator != roads->end();
-       adjacentRoadIterator++)
+  for (Road* road = firstRoad; road != 0; road = *nextOf(road))
   {
-    if ((*adjacentRoadIterator)->begining() != this)
+    if (road->begining() != this)
     {
-      adjacent.push_back((*adjacentRoadIterator)->begining());
+      adjacent.push_back(road->begining());
     }
     else
     {
-      adjacent.push_back((*adjacentRoadIterator)->end());
+      adjacent.push_back(road->end());
     }
   }
 
@@ -65,10 +52,19 @@ std::vector<Intersection*> Intersection::adjacentIntersections()
 
 void Intersection::connectRoad(Road* road) throw()
 {
-  if (road->begining()->position() == *geometrical_position ||
-      road->end()->position()      == *geometrical_position)
+  if (road->begining()->position() == geometrical_position ||
+      road->end()->position()      == geometrical_position)
   {
-    roads->push_back(road);
+    /* Roads are kept in the order they were connected. */
+    Road** last = &firstRoad;
+    while (*last != 0)
+    {
+      last = nextOf(*last);
+    }
+
+    *nextOf(road) = 0;
+    *last = road;
+    ways++;
   }
   else
   {
@@ -79,36 +75,64 @@ void Intersection::connectRoad(Road* road) throw()
 
 void Intersection::disconnectRoad(Road* road)
 {
-  roads->remove(road);
+  for (Road** link = &firstRoad; *link != 0; link = nextOf(*link))
+  {
+    if (*link == road)
+    {
+      *link = *nextOf(road);
+      *nextOf(road) = 0;
+      ways--;
+      return;
+    }
+  }
+}
+
+Road** Intersection::nextOf(Road* road)
+{
+  if (road->begining() == this)
+  {
+    return &road->nextAtBegining;
+  }
+  if (road->end() == this)
+  {
+    return &road->nextAtEnd;
+  }
+
+  /* Road connected by position only. */
+  return road->begining()->position() == geometrical_position ? &road->nextAtBegining : &road->nextAtEnd;
 }
 
 Point Intersection::position() const
 {
-  return *geometrical_position;
+  return geometrical_position;
 }
 
 void Intersection::setPosition(Point const& coordinates)
 {
-  *geometrical_position = coordinates;
+  geometrical_position = coordinates;
 }
 
 int Intersection::numberOfWays() const
 {
-  return roads->size();
+  return ways;
 }
 
 std::list<Road*> Intersection::getRoads()
 {
-  return *roads;
+  std::list<Road*> roads;
+  for (Road* road = firstRoad; road != 0; road = *nextOf(road))
+  {
+    roads.push_back(road);
+  }
+
+  return roads;
 }
 
 bool Intersection::hasRoad(Road* road)
 {
-  for (std::list<Road*>::iterator roadIterator = roads->begin();
-       roadIterator != roads->end();
-       roadIterator++)
+  for (Road* connected = firstRoad; connected != 0; connected = *nextOf(connected))
   {
-    if (*roadIterator == road)
+    if (connected == road)
     {
       return true;
     }
@@ -16,7 +16,8 @@
 #include <list>
 #include <vector>
 
-class Point;
+#include "../geometry/point.h"
+
 class Road;
 
 class Intersection
@@ -42,8 +43,15 @@ class Intersection
     std::list<Road*> getRoads();
 
   private:
-    std::list<Road*>* roads;     /**< Topological information */
-    Point* geometrical_position; /**< Geometrical information */
+    /** Topological information, the roads are chained through
+        their links (see Road::nextAtBegining). */
+    Road* firstRoad;
+    int ways;
+
+    Point geometrical_position; /**< Geometrical information */
+
+    /** Link of the road to the road following it at this intersection. */
+    Road** nextOf(Road* road);
 };
 
 
@@ -0,0 +1,121 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/intersectionindex.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see intersectionindex.h
+ *
+ */
+
+#include "intersectionindex.h"
+#include "intersection.h"
+#include "../geometry/point.h"
+#include "../geometry/units.h"
+#include "../debug.h"
+
+
+IntersectionIndex::IntersectionIndex()
+{
+  initialize();
+}
+
+void IntersectionIndex::initialize()
+{
+  cells = new Cells;
+  numberOfIntersections = 0;
+}
+
+IntersectionIndex::~IntersectionIndex()
+{
+  freeMemory();
+}
+
+void IntersectionIndex::freeMemory()
+{
+  delete cells;
+}
+
+void IntersectionIndex::clear()
+{
+  cells->clear();
+  numberOfIntersections = 0;
+}
+
+int IntersectionIndex::size() const
+{
+  return numberOfIntersections;
+}
+
+IntersectionIndex::Cell IntersectionIndex::cellOf(Point const& position) const
+{
+  /* Cells must not be smaller than the tolerance of Point::operator==,
+     or the neighbouring cells would not hold all the equal points. */
+  return Cell(QuantizedPoint::quantize(position.x(), libcity::COORDINATES_EPSILON),
+              QuantizedPoint::quantize(position.y(), libcity::COORDINATES_EPSILON));
+}
+
+void IntersectionIndex::insert(Intersection* intersection)
+{
+  (*cells)[cellOf(intersection->position())].push_back(intersection);
+  numberOfIntersections++;
+}
+
+void IntersectionIndex::remove(Intersection* intersection)
+{
+  Cells::iterator cell = cells->find(cellOf(intersection->position()));
+  if (cell == cells->end())
+  {
+    return;
+  }
+
+  std::vector<Intersection*>& stored = cell->second;
+  for (std::vector<Intersection*>::iterator storedIntersection = stored.begin();
+       storedIntersection != stored.end();
+       storedIntersection++)
+  {
+    if (*storedIntersection == intersection)
+    {
+      stored.erase(storedIntersection);
+      numberOfIntersections--;
+      break;
+    }
+  }
+
+  if (stored.empty())
+  {
+    cells->erase(cell);
+  }
+}
+
+Intersection* IntersectionIndex::find(Point const& position) const
+{
+  Cell center = cellOf(position);
+  Point searchedPosition(position);
+
+  /* Equal point may lie across the border of a cell. */
+  for (long long x = center.x() - 1; x <= center.x() + 1; x++)
+  {
+    for (long long y = center.y() - 1; y <= center.y() + 1; y++)
+    {
+      Cells::const_iterator cell = cells->find(Cell(x, y));
+      if (cell == cells->end())
+      {
+        continue;
+      }
+
+      for (std::vector<Intersection*>::const_iterator intersection = cell->second.begin();
+           intersection != cell->second.end();
+           intersection++)
+      {
+        if ((*intersection)->position() == searchedPosition)
+        {
+          return *intersection;
+        }
+      }
+    }
+  }
+
+  return 0;
+}
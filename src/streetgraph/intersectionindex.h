@@ -0,0 +1,86 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/intersectionindex.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Spatial index of intersections for lookup by position.
+ *
+ * The plane is divided into the cells of QuantizedPoint's
+ * lattice with the step of libcity::COORDINATES_EPSILON.
+ * Each intersection is stored in the cell its position
+ * falls into.
+ * Two points are considered equal when they are closer than
+ * the epsilon in each coordinate, so an equal point is always
+ * in the same or in one of the eight neighbouring cells.
+ *
+ */
+
+#ifndef _INTERSECTIONINDEX_H_
+#define _INTERSECTIONINDEX_H_
+
+#include <map>
+#include <vector>
+
+#include "../geometry/quantizedpoint.h"
+
+class Point;
+class Intersection;
+
+class IntersectionIndex
+{
+  public:
+    IntersectionIndex();
+    ~IntersectionIndex();
+
+    /**
+      Insert intersection into the index.
+     @remarks
+       The position of the intersection must not change
+       while it is stored in the index.
+     @param[in] intersection Intersection to be indexed.
+     */
+    void insert(Intersection* intersection);
+
+    /**
+      Remove intersection from the index.
+     @param[in] intersection Previously inserted intersection.
+     */
+    void remove(Intersection* intersection);
+
+    void clear();
+
+    /**
+      Find intersection at position.
+     @remarks
+       Positions are compared with Point::operator==, so the
+       result is the same as of a linear search through all
+       the indexed intersections.
+     @param[in] position Where to look for the intersection.
+     @return Intersection at the position or 0 (NULL).
+     */
+    Intersection* find(Point const& position) const;
+
+    int size() const;
+
+  private: /* Copying not allowed */
+    IntersectionIndex(IntersectionIndex const& source);
+    IntersectionIndex& operator=(IntersectionIndex const& source);
+
+  private:
+    /** Cells are in the XY plane, z is always 0. */
+    typedef QuantizedPoint Cell;
+    typedef std::map< Cell, std::vector<Intersection*> > Cells;
+
+    /** Non-empty cells of the grid. */
+    Cells* cells;
+    int numberOfIntersections;
+
+    Cell cellOf(Point const& position) const;
+
+    void initialize();
+    void freeMemory();
+};
+
+#endif
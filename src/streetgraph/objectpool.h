@@ -0,0 +1,166 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/objectpool.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Slab allocator for objects of a single type.
+ *
+ * Memory is taken from the system in slabs of many objects
+ * at once. Released objects are kept in a free list and
+ * reused by the following allocations. All the slabs are
+ * returned to the system at once when the pool is destroyed.
+ *
+ * The pool gives out raw memory only. Objects are created
+ * by placement new and destroyed by calling their destructor
+ * explicitly before being released:
+ *
+ *   Road* road = new (pool.allocate()) Road(first, second);
+ *   road->~Road();
+ *   pool.release(road);
+ *
+ */
+
+#ifndef _OBJECTPOOL_H_
+#define _OBJECTPOOL_H_
+
+#include <cstddef>
+#include <vector>
+
+template <typename T>
+class ObjectPool
+{
+  public:
+    ObjectPool(size_t objectsInSlab = DEFAULT_SLAB_SIZE);
+    ~ObjectPool();
+
+    /**
+      Get memory for one object.
+     @return Uninitialized memory suitable for an object of type T.
+     */
+    void* allocate();
+
+    /**
+      Give memory of an object back to the pool.
+     @remarks
+       The object must already be destroyed.
+     @param[in] object Memory previously returned by allocate().
+     */
+    void release(void* object);
+
+    size_t numberOfObjects() const; /**< Allocated and not released */
+    size_t numberOfSlabs() const;
+
+  private: /* Copying not allowed */
+    ObjectPool(ObjectPool const& source);
+    ObjectPool& operator=(ObjectPool const& source);
+
+  private:
+    static const size_t DEFAULT_SLAB_SIZE = 512;
+
+    /** Storage for one object, aligned for any member of T. */
+    union Slot
+    {
+      Slot* nextFree;
+      char object[sizeof(T)];
+
+      double alignDouble;
+      long double alignLongDouble;
+      long long alignLong;
+      void* alignPointer;
+    };
+
+    std::vector<Slot*>* slabs;
+    Slot* freeSlots;
+
+    size_t slabSize;
+    size_t usedInLastSlab;
+    size_t liveObjects;
+
+    void initialize(size_t objectsInSlab);
+    void freeMemory();
+};
+
+template <typename T>
+ObjectPool<T>::ObjectPool(size_t objectsInSlab)
+{
+  initialize(objectsInSlab);
+}
+
+template <typename T>
+void ObjectPool<T>::initialize(size_t objectsInSlab)
+{
+  slabs = new std::vector<Slot*>;
+  freeSlots = 0;
+  slabSize = objectsInSlab > 0 ? objectsInSlab : 1;
+  usedInLastSlab = slabSize;
+  liveObjects = 0;
+}
+
+template <typename T>
+ObjectPool<T>::~ObjectPool()
+{
+  freeMemory();
+}
+
+template <typename T>
+void ObjectPool<T>::freeMemory()
+{
+  for (typename std::vector<Slot*>::iterator slab = slabs->begin();
+       slab != slabs->end();
+       slab++)
+  {
+    delete [] *slab;
+  }
+  delete slabs;
+}
+
+template <typename T>
+void* ObjectPool<T>::allocate()
+{
+  liveObjects++;
+
+  if (freeSlots != 0)
+  {
+    Slot* reused = freeSlots;
+    freeSlots = reused->nextFree;
+    return reused->object;
+  }
+
+  if (usedInLastSlab == slabSize)
+  {
+    slabs->push_back(new Slot[slabSize]);
+    usedInLastSlab = 0;
+  }
+
+  return slabs->back()[usedInLastSlab++].object;
+}
+
+template <typename T>
+void ObjectPool<T>::release(void* object)
+{
+  if (object == 0)
+  {
+    return;
+  }
+
+  Slot* released = static_cast<Slot*>(object);
+  released->nextFree = freeSlots;
+  freeSlots = released;
+  liveObjects--;
+}
+
+template <typename T>
+size_t ObjectPool<T>::numberOfObjects() const
+{
+  return liveObjects;
+}
+
+template <typename T>
+size_t ObjectPool<T>::numberOfSlabs() const
+{
+  return slabs->size();
+}
+
+#endif
@@ -77,7 +77,7 @@ class Path
 
     std::string toString();
   private:
-   LineSegment *representation;
+   LineSegment representation;
 };
 
 
@@ -31,49 +31,37 @@ Road::Type Road::defineNewRoadType()
 }
 
 Road::Road()
-  : from(0), to(0), geometrical_path(0)
+  : from(0), to(0), nextAtBegining(0), nextAtEnd(0)
 {
-  geometrical_path = new Path;
 }
 
 Road::Road(Intersection *first, Intersection *second)
-  : from(first), to(second), geometrical_path(0)
+  : from(first), to(second),
+    geometrical_path(LineSegment(first->position(), second->position())),
+    nextAtBegining(0), nextAtEnd(0)
 {
-  geometrical_path = new Path(LineSegment(from->position(), to->position()));
 }
 
 Road::Road(Path const& path)
-  : from(0), to(0), geometrical_path(0)
+  : from(0), to(0), geometrical_path(path), nextAtBegining(0), nextAtEnd(0)
 {
-  geometrical_path = new Path(path);
 }
 
 Road::~Road()
 {
   /* "from", "to" are NOT free'd here,
      because they were not allocated by this object. */
-
-  if (geometrical_path != 0)
-  {
-    delete geometrical_path;
-  }
 }
 
 void Road::setPath(Path const& roadPath) throw()
 {
   //TODO: check if the path start and end matches the intersections
-  delete geometrical_path;
-  geometrical_path = new Path(roadPath);
+  geometrical_path = roadPath;
 }
 
 void Road::estimatePath()
 {
-  if (geometrical_path != 0)
-  {
-    delete geometrical_path;
-  }
-
-  geometrical_path = new Path(LineSegment(from->position(), to->position()));
+  geometrical_path = Path(LineSegment(from->position(), to->position()));
 }
 
 Road::Type Road::type()
@@ -89,18 +77,23 @@ void Road::setType(Road::Type type)
 void Road::setBegining(Intersection* intersection)
 {
   from = intersection;
-  geometrical_path->setBegining(from->position());
+  geometrical_path.setBegining(from->position());
 }
 
 void Road::setEnd(Intersection* intersection)
 {
   to = intersection;
-  geometrical_path->setEnd(to->position());
+  geometrical_path.setEnd(to->position());
+}
+
+Path* Road::path()
+{
+  return &geometrical_path;
 }
 
-Path* Road::path() const
+Path const* Road::path() const
 {
-  return geometrical_path;
+  return &geometrical_path;
 }
 
 
@@ -14,9 +14,10 @@
 
 #include <string>
 
+#include "path.h"
+
 class LineSegment;
 class Intersection;
-class Path;
 
 class Road
 {
@@ -49,7 +50,8 @@ class Road
     void setBegining(Intersection* intersection);
     void setEnd(Intersection* intersection);
 
-    Path* path() const;
+    Path* path();
+    Path const* path() const;
     void setPath(Path const& roadPath) throw();
 
     std::string toString();
@@ -65,10 +67,22 @@ class Road
     Intersection* to;   /**< Where it leads to. */
 
     /* Geometrical information */
-    Path* geometrical_path; /**< Path that the road takes between the two topological points */
+    Path geometrical_path; /**< Path that the road takes between the two topological points */
 
     Type roadType;
 
+    /** @{ */
+    /**
+      Next road of the intersection at each end. Intersections
+      chain their roads through these, so they don't allocate
+      any memory for them.
+     */
+    Road* nextAtBegining;
+    Road* nextAtEnd;
+    /** @} */
+
+    friend class Intersection;
+
     void estimatePath();
 };
 
@@ -0,0 +1,267 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/roadindex.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @see roadindex.h
+ *
+ */
+
+#include "roadindex.h"
+#include "road.h"
+#include "path.h"
+#include "../geometry/linesegment.h"
+#include "../geometry/units.h"
+#include "../debug.h"
+
+#include <algorithm>
+#include <cmath>
+
+const double RoadIndex::DEFAULT_CELL_SIZE = 10*libcity::METERS;
+
+RoadIndex::RoadIndex()
+{
+  initialize(DEFAULT_CELL_SIZE);
+}
+
+RoadIndex::RoadIndex(double cellSize)
+{
+  initialize(cellSize);
+}
+
+void RoadIndex::initialize(double cellSize)
+{
+  assert(cellSize > 0);
+
+  cells = new std::map< Cell, std::vector<Slot> >;
+  records = new std::vector<IndexedRoad>;
+  freeSlots = new std::vector<Slot>;
+  slots = new std::map<Road*, Slot>;
+  size = cellSize;
+  insertedRoads = 0;
+}
+
+RoadIndex::~RoadIndex()
+{
+  freeMemory();
+}
+
+void RoadIndex::freeMemory()
+{
+  delete cells;
+  delete records;
+  delete freeSlots;
+  delete slots;
+}
+
+void RoadIndex::clear()
+{
+  cells->clear();
+  records->clear();
+  freeSlots->clear();
+  slots->clear();
+  insertedRoads = 0;
+}
+
+long long RoadIndex::cellCoordinate(double coordinate) const
+{
+  return static_cast<long long>(std::floor(coordinate / size));
+}
+
+void RoadIndex::setSegment(IndexedRoad* record, Road* road) const
+{
+  record->from = road->path()->begining();
+  record->to = road->path()->end();
+  record->box = BoundingBox(record->from, record->to);
+}
+
+void RoadIndex::cellsOf(IndexedRoad const& record, std::vector<Cell>* crossed) const
+{
+  double tolerance = LineSegment::BOX_TOLERANCE;
+  Point const& from = record.from;
+  Point const& to = record.to;
+
+  /* Walk the columns of the grid the segment passes through and
+     register only the rows covered by its part in each column. */
+  for (long long x = cellCoordinate(record.box.minX() - tolerance);
+       x <= cellCoordinate(record.box.maxX() + tolerance);
+       x++)
+  {
+    double left = std::max(x*size - tolerance, record.box.minX());
+    double right = std::min((x + 1)*size + tolerance, record.box.maxX());
+
+    double bottom = record.box.minY();
+    double top = record.box.maxY();
+    if (from.x() != to.x())
+    {
+      double slope = (to.y() - from.y()) / (to.x() - from.x());
+      double leftY = from.y() + (left - from.x())*slope;
+      double rightY = from.y() + (right - from.x())*slope;
+
+      bottom = std::max(std::min(leftY, rightY), bottom);
+      top = std::min(std::max(leftY, rightY), top);
+    }
+
+    for (long long y = cellCoordinate(bottom - tolerance);
+         y <= cellCoordinate(top + tolerance);
+         y++)
+    {
+      crossed->push_back(Cell(x, y));
+    }
+  }
+}
+
+void RoadIndex::insert(Road* road)
+{
+  Slot slot = records->size();
+  if (!freeSlots->empty())
+  {
+    slot = freeSlots->back();
+    freeSlots->pop_back();
+  }
+  else
+  {
+    records->push_back(IndexedRoad());
+  }
+
+  IndexedRoad& record = (*records)[slot];
+  record.order = insertedRoads++;
+  record.road = road;
+  setSegment(&record, road);
+
+  (*slots)[road] = slot;
+  registerRoad(slot);
+}
+
+void RoadIndex::update(Road* road)
+{
+  std::map<Road*, Slot>::iterator indexed = slots->find(road);
+  if (indexed == slots->end())
+  {
+    insert(road);
+    return;
+  }
+
+  unregisterRoad(indexed->second);
+  setSegment(&(*records)[indexed->second], road);
+  registerRoad(indexed->second);
+}
+
+void RoadIndex::remove(Road* road)
+{
+  std::map<Road*, Slot>::iterator indexed = slots->find(road);
+  if (indexed == slots->end())
+  {
+    return;
+  }
+
+  unregisterRoad(indexed->second);
+  (*records)[indexed->second].road = 0;
+  freeSlots->push_back(indexed->second);
+  slots->erase(indexed);
+}
+
+void RoadIndex::registerRoad(Slot slot)
+{
+  std::vector<Cell> crossed;
+  cellsOf((*records)[slot], &crossed);
+
+  for (std::vector<Cell>::iterator cell = crossed.begin();
+       cell != crossed.end();
+       cell++)
+  {
+    (*cells)[*cell].push_back(slot);
+  }
+}
+
+void RoadIndex::unregisterRoad(Slot slot)
+{
+  std::vector<Cell> crossed;
+  cellsOf((*records)[slot], &crossed);
+
+  for (std::vector<Cell>::iterator position = crossed.begin();
+       position != crossed.end();
+       position++)
+  {
+    std::map< Cell, std::vector<Slot> >::iterator cell = cells->find(*position);
+    if (cell == cells->end())
+    {
+      continue;
+    }
+
+    std::vector<Slot>& entries = cell->second;
+    std::vector<Slot>::iterator entry = std::find(entries.begin(), entries.end(), slot);
+    if (entry != entries.end())
+    {
+      entries.erase(entry);
+    }
+
+    if (entries.empty())
+    {
+      cells->erase(cell);
+    }
+  }
+}
+
+std::vector<Road*> RoadIndex::query(BoundingBox const& area) const
+{
+  std::vector<Candidate> candidates;
+  std::vector<Road*> roads;
+
+  if (area.isEmpty())
+  {
+    return roads;
+  }
+
+  long long minY = cellCoordinate(area.minY());
+  long long maxY = cellCoordinate(area.maxY());
+  Cell last(cellCoordinate(area.maxX()), maxY);
+
+  /* Only non-empty cells are visited, rows of a column outside
+     of the area are skipped with a single lookup. */
+  std::map< Cell, std::vector<Slot> >::const_iterator cell;
+  cell = cells->lower_bound(Cell(cellCoordinate(area.minX()), minY));
+  while (cell != cells->end() && !(last < cell->first))
+  {
+    long long x = cell->first.first;
+    long long y = cell->first.second;
+    if (y < minY)
+    {
+      cell = cells->lower_bound(Cell(x, minY));
+      continue;
+    }
+    if (y > maxY)
+    {
+      cell = cells->lower_bound(Cell(x + 1, minY));
+      continue;
+    }
+
+    for (std::vector<Slot>::const_iterator slot = cell->second.begin();
+         slot != cell->second.end();
+         slot++)
+    {
+      IndexedRoad const& entry = (*records)[*slot];
+      if (entry.box.intersects(area))
+      {
+        candidates.push_back(Candidate(entry.order, entry.road));
+      }
+    }
+    cell++;
+  }
+
+  /* Roads spanning more cells were found several times. */
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+  roads.reserve(candidates.size());
+  for (std::vector<Candidate>::iterator candidate = candidates.begin();
+       candidate != candidates.end();
+       candidate++)
+  {
+    roads.push_back(candidate->second);
+  }
+
+  return roads;
+}
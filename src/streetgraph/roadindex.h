@@ -0,0 +1,124 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/roadindex.h
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Spatial index of roads for finding nearby roads.
+ *
+ * Each road is registered in the cells of a uniform grid its
+ * segment passes through (with a small reserve), so long
+ * diagonal roads don't fill the whole area of their bounding
+ * box. Query then collects roads from the non-empty cells
+ * overlapped by the queried box.
+ *
+ * The index remembers in which order the roads were inserted
+ * and returns candidates in this order. Results of algorithms
+ * that stop at the first match (like splitting of roads in
+ * StreetGraph) are the same as if all the roads were searched.
+ *
+ */
+
+#ifndef _ROADINDEX_H_
+#define _ROADINDEX_H_
+
+#include <map>
+#include <vector>
+#include <utility>
+
+#include "../geometry/point.h"
+#include "../geometry/boundingbox.h"
+
+class Road;
+
+class RoadIndex
+{
+  public:
+    RoadIndex();
+    RoadIndex(double cellSize);
+    ~RoadIndex();
+
+    /**
+      Insert road into the index.
+     @remarks
+       Roads inserted later come after the earlier ones
+       in query results.
+     @param[in] road Road to be indexed.
+     */
+    void insert(Road* road);
+
+    /**
+      Update the cells of a road after its path has changed.
+     @remarks
+       The road keeps its place in the order of roads.
+     @param[in] road Road already in the index.
+     */
+    void update(Road* road);
+
+    /**
+      Remove road from the index.
+     @param[in] road Previously inserted road.
+     */
+    void remove(Road* road);
+
+    void clear();
+
+    /**
+      Find roads that may pass through the area.
+     @remarks
+       Returned roads pass near the area and their bounding
+       box overlaps it. Exact geometry is left to the caller.
+     @param[in] area Searched area.
+     @return Candidate roads in the order of insertion.
+     */
+    std::vector<Road*> query(BoundingBox const& area) const;
+
+  private: /* Copying not allowed */
+    RoadIndex(RoadIndex const& source);
+    RoadIndex& operator=(RoadIndex const& source);
+
+  private:
+    const static double DEFAULT_CELL_SIZE;
+
+    typedef std::pair<long long, long long> Cell;
+    typedef std::pair<unsigned long, Road*> Candidate;
+    typedef unsigned long Slot;
+
+    struct IndexedRoad
+    {
+      unsigned long order;
+      Road* road;
+      Point from;
+      Point to;
+      BoundingBox box;
+    };
+
+    /** Slots of the roads registered in each non-empty cell. */
+    std::map< Cell, std::vector<Slot> >* cells;
+
+    /** Order and registered segment of each road, stored once. */
+    std::vector<IndexedRoad>* records;
+
+    /** Slots of removed roads, reused by the next insertions. */
+    std::vector<Slot>* freeSlots;
+
+    /** Slot of each indexed road. */
+    std::map<Road*, Slot>* slots;
+
+    double size;
+    unsigned long insertedRoads;
+
+    long long cellCoordinate(double coordinate) const;
+
+    void setSegment(IndexedRoad* record, Road* road) const;
+    void cellsOf(IndexedRoad const& record, std::vector<Cell>* crossed) const;
+
+    void registerRoad(Slot slot);
+    void unregisterRoad(Slot slot);
+
+    void initialize(double cellSize);
+    void freeMemory();
+};
+
+#endif
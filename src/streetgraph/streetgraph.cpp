@@ -12,17 +12,25 @@
 #include "streetgraph.h"
 #include "road.h"
 #include "intersection.h"
+#include "intersectionindex.h"
+#include "roadindex.h"
+#include "faceindex.h"
+#include "objectpool.h"
 #include "../area/zone.h"
 #include "path.h"
 #include "areaextractor.h"
 #include "../lsystem/roadlsystem.h"
 #include "../geometry/polygon.h"
+#include "../geometry/boundingbox.h"
 #include "../geometry/linesegment.h"
+#include "../geometry/segmentbatch.h"
 #include "../geometry/point.h"
 #include "../geometry/vector.h"
 #include "../geometry/units.h"
 #include "../debug.h"
 
+#include <algorithm>
+#include <new>
 #include <set>
 #include <string>
 #include <sstream>
@@ -34,8 +42,14 @@ StreetGraph::StreetGraph()
 
 void StreetGraph::initialize()
 {
-  roads = new std::list<Road*>;
-  intersections = new std::list<Intersection*>;
+  roads = new std::vector<Road*>;
+  intersections = new std::vector<Intersection*>;
+  roadPool = new ObjectPool<Road>;
+  intersectionPool = new ObjectPool<Intersection>;
+  intersectionIndex = new IntersectionIndex;
+  roadIndex = new RoadIndex;
+  faceIndex = new FaceIndex;
+  facesTracked = false;
 }
 
 StreetGraph::~StreetGraph()
@@ -45,24 +59,16 @@ StreetGraph::~StreetGraph()
 
 void StreetGraph::freeMemory()
 {
-  Intersection *removedIntersection = 0;
-  Road *removedRoad = 0;
-
-  while (!intersections->empty())
-  {
-    removedIntersection = intersections->back();
-    delete removedIntersection;
-    intersections->pop_back();
-  }
+  /* Roads and intersections are released with the pools,
+     their destructors have nothing to do. */
   delete intersections;
-
-  while (!roads->empty())
-  {
-    removedRoad = roads->back();
-    delete removedRoad;
-    roads->pop_back();
-  }
+  delete intersectionIndex;
+  delete roadIndex;
+  delete faceIndex;
   delete roads;
+
+  delete intersectionPool;
+  delete roadPool;
 }
 
 std::list<Zone*> StreetGraph::findZones()
@@ -72,6 +78,59 @@ std::list<Zone*> StreetGraph::findZones()
   return graph.extractZones(this);
 }
 
+void StreetGraph::trackFaces(bool track)
+{
+  if (track == facesTracked)
+  {
+    return;
+  }
+
+  facesTracked = track;
+  if (track)
+  {
+    faceIndex->build(*roads);
+  }
+  else
+  {
+    faceIndex->clear();
+  }
+}
+
+std::list<Zone*> StreetGraph::findFaceZones()
+{
+  return findFaceZones(faceIndex->faces());
+}
+
+std::list<Zone*> StreetGraph::findFaceZones(std::vector<FaceIndex::Face> const& faces)
+{
+  std::list<Zone*> zones;
+  std::vector<Polygon> areas;
+
+  for (std::vector<FaceIndex::Face>::const_iterator face = faces.begin();
+       face != faces.end();
+       face++)
+  {
+    areas.clear();
+    faceIndex->areas(*face, &areas);
+
+    for (std::vector<Polygon>::iterator area = areas.begin();
+         area != areas.end();
+         area++)
+    {
+      Zone* newZone = new Zone(this);
+      newZone->setAreaConstraints(*area);
+      zones.push_back(newZone);
+    }
+  }
+
+  return zones;
+}
+
+void StreetGraph::takeFaceChanges(std::vector<FaceIndex::Face>* created, std::vector<FaceIndex::Face>* destroyed)
+{
+  faceIndex->takeChanges(created, destroyed);
+}
+
 Road* StreetGraph::getRoadBetweenIntersections(Intersection* first, Intersection* second)
 {
   std::list<Road*> roadsOfFirst = first->getRoads();
@@ -95,12 +154,34 @@ void StreetGraph::addRoad(Path const& path, Road::Type roadType)
 {
   Path roadPath(path);
   Point intersection;
-  for (StreetGraph::iterator currentRoad = begin();
-        currentRoad != end();
+
+  /* Only roads near the new one can cross it. */
+  BoundingBox area(roadPath.begining(), roadPath.end());
+  area.expand(libcity::COORDINATES_EPSILON);
+  std::vector<Road*> nearRoads = roadIndex->query(area);
+
+  /* Reject most of the near roads at once, only the candidates
+     need the exact test. */
+  SegmentBatch nearSegments;
+  for (std::vector<Road*>::iterator currentRoad = nearRoads.begin();
+        currentRoad != nearRoads.end();
         currentRoad++)
   {
+    nearSegments.add((*currentRoad)->path()->begining(), (*currentRoad)->path()->end());
+  }
+
+  std::vector<SegmentBatch::MaskWord> candidates;
+  nearSegments.findCandidates(LineSegment(roadPath.begining(), roadPath.end()), &candidates);
+
+  for (size_t index = 0; index < nearRoads.size(); index++)
+  {
+    if (!SegmentBatch::isCandidate(candidates, index))
+    {
+      continue;
+    }
+
     // Check for intersection
-    LineSegment::Intersection intersectionResult = roadPath.crosses(*(*currentRoad)->path(), &intersection);
+    LineSegment::Intersection intersectionResult = roadPath.crosses(*nearRoads[index]->path(), &intersection);
     if (intersectionResult == LineSegment::CONTAINED ||
         intersectionResult == LineSegment::IDENTICAL)
     {
@@ -137,16 +218,221 @@ void StreetGraph::addRoad(Path const& path, Road::Type roadType)
   Intersection *begining = addIntersection(roadPath.begining());
   Intersection *end = addIntersection(roadPath.end());
 
-  Road *newRoad = new Road(begining, end);
+  connectIntersections(begining, end, roadType);
+  return;
+}
+
+void StreetGraph::addRoads(std::vector<Path> const& paths, Road::Type roadType)
+{
+  std::vector<Path> newPaths(paths);
+  std::vector< std::vector<SplitPoint> > splitPoints(newPaths.size());
+  std::vector<Crossing> crossings;
+  Point intersection;
+
+  /* Paths overlapping an existing road or an earlier path
+     along the same line are not added, as in addRoad(). */
+  std::vector<bool> rejected(newPaths.size(), false);
+  std::vector< std::vector<size_t> > overlappedPaths(newPaths.size());
+
+  /* Sweep the new paths from left to right. Only the paths
+     whose x ranges overlap can cross each other. */
+  std::vector<SweptPath> sweepOrder;
+  sweepOrder.reserve(newPaths.size());
+  for (size_t index = 0; index < newPaths.size(); index++)
+  {
+    SweptPath swept;
+    swept.box = BoundingBox(newPaths[index].begining(), newPaths[index].end());
+    swept.box.expand(libcity::COORDINATES_EPSILON);
+    swept.index = index;
+    sweepOrder.push_back(swept);
+  }
+  std::sort(sweepOrder.begin(), sweepOrder.end());
+
+  /* Active paths ordered by the end of their x range. */
+  std::multiset<SweptPath, SweptPath::EndsBefore> active;
+  for (std::vector<SweptPath>::iterator current = sweepOrder.begin();
+       current != sweepOrder.end();
+       current++)
+  {
+    /* Drop paths that end before the current one begins. */
+    while (!active.empty() && active.begin()->box.maxX() < current->box.minX())
+    {
+      active.erase(active.begin());
+    }
+
+    for (std::multiset<SweptPath, SweptPath::EndsBefore>::iterator other = active.begin();
+         other != active.end();
+         other++)
+    {
+      /* X ranges overlap, the paths may meet only if y ranges do too. */
+      if (other->box.maxY() < current->box.minY() ||
+          other->box.minY() > current->box.maxY())
+      {
+        continue;
+      }
+
+      Path& first = newPaths[current->index];
+      Path& second = newPaths[other->index];
+      LineSegment::Intersection result = first.crosses(second, &intersection);
+      if (result == LineSegment::INTERSECTING)
+      {
+        Crossing crossing;
+        crossing.first = current->index;
+        crossing.second = other->index;
+        crossing.position = intersection;
+        crossings.push_back(crossing);
+      }
+      else if (result != LineSegment::NONINTERSECTING)
+      {
+        size_t later = std::max(current->index, other->index);
+        overlappedPaths[later].push_back(std::min(current->index, other->index));
+      }
+    }
+
+    active.insert(*current);
+  }
+
+  /* Crossings with the roads already in the graph, most of the
+     near roads are rejected at once as in addRoad(). */
+  SegmentBatch nearSegments;
+  std::vector<SegmentBatch::MaskWord> candidates;
+  for (size_t index = 0; index < newPaths.size(); index++)
+  {
+    BoundingBox area(newPaths[index].begining(), newPaths[index].end());
+    area.expand(libcity::COORDINATES_EPSILON);
+    std::vector<Road*> nearRoads = roadIndex->query(area);
+
+    nearSegments.clear();
+    for (std::vector<Road*>::iterator road = nearRoads.begin();
+         road != nearRoads.end();
+         road++)
+    {
+      nearSegments.add((*road)->path()->begining(), (*road)->path()->end());
+    }
+    nearSegments.findCandidates(LineSegment(newPaths[index].begining(), newPaths[index].end()), &candidates);
+
+    for (size_t road = 0; road < nearRoads.size(); road++)
+    {
+      if (!SegmentBatch::isCandidate(candidates, road))
+      {
+        continue;
+      }
+
+      LineSegment::Intersection result = newPaths[index].crosses(*nearRoads[road]->path(), &intersection);
+      if (result == LineSegment::INTERSECTING)
+      {
+        addSplitPoint(newPaths[index], intersection, &splitPoints[index]);
+      }
+      else if (result != LineSegment::NONINTERSECTING)
+      {
+        rejected[index] = true;
+      }
+    }
+  }
+
+  /* Earlier paths win, a path overlapped only by rejected
+     paths is still added. */
+  for (size_t index = 0; index < newPaths.size(); index++)
+  {
+    for (std::vector<size_t>::iterator earlier = overlappedPaths[index].begin();
+         earlier != overlappedPaths[index].end() && !rejected[index];
+         earlier++)
+    {
+      rejected[index] = !rejected[*earlier];
+    }
+  }
+
+  for (std::vector<Crossing>::iterator crossing = crossings.begin();
+       crossing != crossings.end();
+       crossing++)
+  {
+    if (rejected[crossing->first] || rejected[crossing->second])
+    {
+      continue;
+    }
+
+    addSplitPoint(newPaths[crossing->first], crossing->position, &splitPoints[crossing->first]);
+    addSplitPoint(newPaths[crossing->second], crossing->position, &splitPoints[crossing->second]);
+  }
+
+  /* Create all intersections first. Existing roads going
+     through them are split, the new ones are not built yet. */
+  std::vector< std::vector<Intersection*> > pathIntersections(newPaths.size());
+  for (size_t index = 0; index < newPaths.size(); index++)
+  {
+    if (rejected[index])
+    {
+      continue;
+    }
+
+    std::vector<SplitPoint>& points = splitPoints[index];
+    std::sort(points.begin(), points.end());
+
+    std::vector<Intersection*>& chain = pathIntersections[index];
+    chain.push_back(addIntersection(newPaths[index].begining()));
+    for (std::vector<SplitPoint>::iterator point = points.begin();
+         point != points.end();
+         point++)
+    {
+      Intersection* split = addIntersection(point->position);
+      if (split != chain.back())
+      {
+        chain.push_back(split);
+      }
+    }
+
+    Intersection* end = addIntersection(newPaths[index].end());
+    if (end != chain.back())
+    {
+      chain.push_back(end);
+    }
+  }
+
+  /* Connect the intersections along each path. */
+  for (size_t index = 0; index < newPaths.size(); index++)
+  {
+    std::vector<Intersection*>& chain = pathIntersections[index];
+    for (size_t piece = 1; piece < chain.size(); piece++)
+    {
+      if (getRoadBetweenIntersections(chain[piece - 1], chain[piece]) == 0)
+      {
+        connectIntersections(chain[piece - 1], chain[piece], roadType);
+      }
+    }
+  }
+}
+
+void StreetGraph::addSplitPoint(Path const& path, Point const& point, std::vector<SplitPoint>* splitPoints)
+{
+  Point position(point);
+  if (position == path.begining() || position == path.end())
+  /* Path is just touching the other one */
+  {
+    return;
+  }
+
+  SplitPoint split;
+  split.distance = Vector(path.begining(), position).length();
+  split.position = position;
+  splitPoints->push_back(split);
+}
+
+Road* StreetGraph::connectIntersections(Intersection* begining, Intersection* end, Road::Type roadType)
+{
+  Road *newRoad = createRoad(begining, end);
   newRoad->setType(roadType);
-  //newRoad->setPath(roadPath);
 
   // Connect road to intersections
   begining->connectRoad(newRoad);
   end->connectRoad(newRoad);
 
   roads->push_back(newRoad);
-  return;
+  roadIndex->insert(newRoad);
+  if (facesTracked)
+  {
+    faceIndex->insert(newRoad);
+  }
+  return newRoad;
 }
 
 void StreetGraph::removeRoad(Road* road)
@@ -154,46 +440,76 @@ void StreetGraph::removeRoad(Road* road)
   Intersection* begining = road->begining();
   Intersection* end = road->end();
 
+  if (facesTracked)
+  {
+    faceIndex->remove(road);
+  }
   begining->disconnectRoad(road);
   if (begining->numberOfWays() == 0)
   {
-    intersections->remove(begining);
-    delete begining;
+    intersectionIndex->remove(begining);
+    intersections->erase(std::find(intersections->begin(), intersections->end(), begining));
+    destroyIntersection(begining);
   }
 
   end->disconnectRoad(road);
   if (end->numberOfWays() == 0)
   {
-    intersections->remove(end);
-    delete end;
+    intersectionIndex->remove(end);
+    intersections->erase(std::find(intersections->begin(), intersections->end(), end));
+    destroyIntersection(end);
   }
 
-  
-  roads->remove(road);
+  roadIndex->remove(road);
+  roads->erase(std::find(roads->begin(), roads->end(), road));
+  destroyRoad(road);
+}
+
+Road* StreetGraph::createRoad(Intersection* begining, Intersection* end)
+{
+  return new (roadPool->allocate()) Road(begining, end);
+}
+
+void StreetGraph::destroyRoad(Road* road)
+{
+  road->~Road();
+  roadPool->release(road);
+}
+
+Intersection* StreetGraph::createIntersection(Point const& position)
+{
+  return new (intersectionPool->allocate()) Intersection(position);
+}
+
+void StreetGraph::destroyIntersection(Intersection* intersection)
+{
+  intersection->~Intersection();
+  intersectionPool->release(intersection);
 }
 
 Intersection* StreetGraph::addIntersection(Point const& position)
 {
   /* Search for existing intersection. */
-  for (std::list<Intersection*>::iterator intersection = intersections->begin();
-       intersection != intersections->end();
-       intersection++)
+  Intersection *existing = intersectionIndex->find(position);
+  if (existing != 0)
   {
-    if ((*intersection)->position() == position)
-    {
-      return *intersection;
-    }
+    return existing;
   }
 
   /* There's no existing intersection at position. Create one */
-  Intersection *newIntersection = new Intersection(position);
+  Intersection *newIntersection = createIntersection(position);
   intersections->push_back(newIntersection);
+  intersectionIndex->insert(newIntersection);
 
   //debug("StreetGraph::addIntersection(): Adding intersection Intersection " << newIntersection->position().toString());
 
   /* Check if the existing intersection crosses any existing road. */
-  for (std::list<Road*>::iterator road = roads->begin();
-       road != roads->end();
+  BoundingBox area(position, position);
+  area.expand(libcity::COORDINATES_EPSILON);
+  std::vector<Road*> nearRoads = roadIndex->query(area);
+
+  for (std::vector<Road*>::iterator road = nearRoads.begin();
+       road != nearRoads.end();
        road++)
   {
     if ((*road)->path()->goesThrough(position))
@@ -203,17 +519,31 @@ Intersection* StreetGraph::addIntersection(Point const& position)
 
       Intersection *end = (*road)->end();
       assert(!(LineSegment((*road)->begining()->position(), end->position()) == LineSegment(Point(-3000, -2509.3, 0), Point(-3000, -2244.59, 0))));
+      if (facesTracked)
+      {
+        faceIndex->remove(*road);
+      }
       end->disconnectRoad(*road);
 
       (*road)->setEnd(newIntersection);
       newIntersection->connectRoad(*road);
+      roadIndex->update(*road);
+      if (facesTracked)
+      {
+        faceIndex->insert(*road);
+      }
 
-      Road* secondPart = new Road(newIntersection, end);
+      Road* secondPart = createRoad(newIntersection, end);
       secondPart->setType((*road)->type());
       roads->push_back(secondPart);
+      roadIndex->insert(secondPart);
 
       newIntersection->connectRoad(secondPart);
       end->connectRoad(secondPart);
+      if (facesTracked)
+      {
+        faceIndex->insert(secondPart);
+      }
 
       assert(!(LineSegment((*road)->begining()->position(), end->position()) == LineSegment(Point(-3000, -2509.3, 0), Point(-3000, -2244.59, 0))));
       assert(!(LineSegment(newIntersection->position(), end->position()) == LineSegment(Point(-3000, 837.305, 0), Point(-3000, -2509.3, 0))));
@@ -237,34 +567,17 @@ StreetGraph::iterator StreetGraph::end()
 
 bool StreetGraph::isIntersectionAtPosition(Point const& position)
 {
-  /* Search for existing intersection. */
-  for (std::list<Intersection*>::iterator intersection = intersections->begin();
-       intersection != intersections->end();
-       intersection++)
-  {
-    if ((*intersection)->position() == position)
-    {
-      return true;
-    }
-  }
-
-  return false;
+  return intersectionIndex->find(position) != 0;
 }
 
 Intersection* StreetGraph::getIntersectionAtPosition(Point const& position)
 {
-  /* Search for existing intersection. */
-  for (std::list<Intersection*>::iterator intersection = intersections->begin();
-       intersection != intersections->end();
-       intersection++)
-  {
-    if ((*intersection)->position() == position)
-    {
-      return (*intersection);
-    }
-  }
+  return intersectionIndex->find(position);
+}
 
-  return 0;
+std::vector<Road*> StreetGraph::getRoadsInArea(BoundingBox const& area)
+{
+  return roadIndex->query(area);
 }
 
 int StreetGraph::numberOfRoads()
@@ -275,12 +588,12 @@ int StreetGraph::numberOfRoads()
 
 StreetGraph::Intersections StreetGraph::getIntersections()
 {
-  return *intersections;
+  return Intersections(intersections->begin(), intersections->end());
 }
 
 StreetGraph::Roads StreetGraph::getRoads()
 {
-  return *roads;
+  return Roads(roads->begin(), roads->end());
 }
 
 void StreetGraph::checkConsistence()
@@ -290,8 +603,12 @@ void StreetGraph::checkConsistence()
         currentRoad != end();
         currentRoad++)
   {
-    for (StreetGraph::iterator nextRoad = begin();
-        nextRoad != end();
+    BoundingBox area((*currentRoad)->path()->begining(), (*currentRoad)->path()->end());
+    area.expand(libcity::COORDINATES_EPSILON);
+    std::vector<Road*> nearRoads = roadIndex->query(area);
+
+    for (std::vector<Road*>::iterator nextRoad = nearRoads.begin();
+        nextRoad != nearRoads.end();
         nextRoad++)
     {
       if (*nextRoad == *currentRoad) continue;
@@ -337,7 +654,7 @@ void StreetGraph::removeFilamentRoads()
   Intersection* roadEnd;
   Roads filaments;
 
-  for (Roads::iterator road = roads->begin();
+  for (std::vector<Road*>::iterator road = roads->begin();
        road != roads->end();
        road++)
   {
@@ -363,7 +680,7 @@ std::string StreetGraph::toString()
 {
   std::stringstream output;
   output << "Roads:\n";
-  for (Roads::iterator road = roads->begin();
+  for (std::vector<Road*>::iterator road = roads->begin();
        road != roads->end();
        road++)
   {
@@ -373,7 +690,7 @@ std::string StreetGraph::toString()
   }
 
   output << "Intersections:\n";
-  for (Intersections::iterator intersection = intersections->begin();
+  for (std::vector<Intersection*>::iterator intersection = intersections->begin();
        intersection != intersections->end();
        intersection++)
   {
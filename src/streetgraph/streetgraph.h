@@ -31,12 +31,20 @@
 
 class Intersection;
 class Zone;
-class Point;
 class Polygon;
 class Path;
 class LineSegment;
+class IntersectionIndex;
+class RoadIndex;
+class FaceIndex;
+
+template <typename T> class ObjectPool;
+class BoundingBox;
 
 #include "road.h"
+#include "faceindex.h"
+#include "../geometry/boundingbox.h"
+#include "../geometry/point.h"
 
 class StreetGraph
 {
@@ -47,7 +55,7 @@ class StreetGraph
 
     /** @{ */
     /** For iterating through the roads of StreetGraph. */
-    typedef std::list<Road*>::iterator iterator;
+    typedef std::vector<Road*>::iterator iterator;
     iterator begin();
     iterator end();
     /** @} */
@@ -74,6 +82,50 @@ class StreetGraph
      */
     std::list<Zone*> findZones();
 
+    /**
+      Keep the faces of the graph up to date (see FaceIndex).
+     @remarks
+       Off by default. Meant for editors that change a finished
+       graph road by road and need the zones after every edit.
+       Every edit retraces the faces around the changed road,
+       the outer face included, so generating a large network
+       with tracking on would take quadratic time. Turning it
+       on indexes the current roads at once.
+     @param[in] track Track the faces from now on or stop it.
+     */
+    void trackFaces(bool track);
+
+    /**
+      Form zones inside the faces of the graph.
+     @remarks
+       Requires trackFaces(true), otherwise there are no faces.
+       The zones are just read from the current faces, filaments
+       and roads leading into a zone are not part of its border.
+       The result may differ from findZones(): the minimal cycle
+       basis can contain cycles enclosing several faces (e.g. on
+       a grid crossed by a diagonal), here every face gives its
+       own zones and they never overlap.
+     @return List of pointers to all zones found.
+     */
+    std::list<Zone*> findFaceZones();
+
+    /**
+      Form zones inside some faces only.
+     @remarks
+       Used to update the zones after an edit, together with
+       takeFaceChanges().
+     @param[in] faces Current faces of the graph.
+     @return Zones inside the faces.
+     */
+    std::list<Zone*> findFaceZones(std::vector<FaceIndex::Face> const& faces);
+
+    /**
+      Faces created and destroyed since the last call.
+     @param[out] created   New faces of the graph.
+     @param[out] destroyed Faces that no longer exist.
+     */
+    void takeFaceChanges(std::vector<FaceIndex::Face>* created, std::vector<FaceIndex::Face>* destroyed);
+
     /**
       Add road that follows certain path into the StreetGraph.
      @remarks
@@ -86,6 +138,29 @@ class StreetGraph
     */
     void addRoad(Path const& path, Road::Type roadTypes = Road::PRIMARY_ROAD);
 
+    /**
+      Add many roads into the StreetGraph at once.
+     @remarks
+       Crossings among the new paths are found by sweeping
+       them from left to right. The sweep keeps the paths
+       whose x ranges contain the current position and tests
+       each new path against all of them (cheap rejection on
+       y ranges first), so it takes O(n log n + n*k) time
+       where k is the largest number of such paths. That is
+       near linear for short streets, but a bundle of long
+       parallel avenues makes it O(n^2). Crossings with the
+       existing roads are found through the road index. The
+       paths are split at all the crossings before any road
+       is built. The resulting graph obeys the same planarity
+       rules as with addRoad(). A path lying along an existing
+       road or an earlier path in the vector (overlapping,
+       containing, contained or identical) is not added.
+
+     @param[in] paths    Paths of the new roads.
+     @param[in] roadType Type of all the new roads.
+    */
+    void addRoads(std::vector<Path> const& paths, Road::Type roadType = Road::PRIMARY_ROAD);
+
     /**
       Erase road from the StreetGraph.
      @remarks
@@ -106,8 +181,28 @@ class StreetGraph
      */
     int numberOfRoads();
 
+    /** @{ */
+    /**
+      Look up intersection by its position.
+     @remarks
+       Intersections are kept in a spatial index, so the lookup
+       takes logarithmic time instead of scanning the whole graph.
+     */
     bool isIntersectionAtPosition(Point const& position);
     Intersection* getIntersectionAtPosition(Point const& position);
+    /** @} */
+
+    /**
+      Find roads that may lie in certain area.
+     @remarks
+       Roads are kept in a spatial index, so only the roads
+       around the area are visited. Roads passing near the area
+       are returned, callers still need to test the exact
+       geometry.
+     @param[in] area Searched area.
+     @return Roads in the order they were added to the graph.
+     */
+    std::vector<Road*> getRoadsInArea(BoundingBox const& area);
 
     /**
       Get road that connects two intersections.
@@ -125,10 +220,38 @@ class StreetGraph
 
   private:
     /** All intersections in the street graph. */
-    Intersections* intersections;
+    std::vector<Intersection*>* intersections;
 
     /** All roads in the street graph. */
-    Roads* roads;
+    std::vector<Road*>* roads;
+
+    /** Intersections indexed by their position. */
+    IntersectionIndex* intersectionIndex;
+
+    /** Roads indexed by the area they span. */
+    RoadIndex* roadIndex;
+
+    /** Faces of the graph, empty unless they are tracked. */
+    FaceIndex* faceIndex;
+    bool facesTracked;
+
+    /** @{ */
+    /**
+      Memory of all the roads and intersections of the graph.
+      They own no other memory, so it's released at once when
+      the graph is destroyed without calling their destructors.
+     */
+    ObjectPool<Road>* roadPool;
+    ObjectPool<Intersection>* intersectionPool;
+    /** @} */
+
+    /** @{ */
+    /** Roads and intersections must be created and destroyed only by these. */
+    Road* createRoad(Intersection* begining, Intersection* end);
+    void destroyRoad(Road* road);
+    Intersection* createIntersection(Point const& position);
+    void destroyIntersection(Intersection* intersection);
+    /** @} */
 
     /**
       Method for adding new intersections to the graph.
@@ -143,6 +266,53 @@ class StreetGraph
      */
     Intersection* addIntersection(Point const& position);
 
+    /** Point where a new path must be split (used by addRoads()). */
+    struct SplitPoint
+    {
+      double distance; /**< Distance from the begining of the path */
+      Point position;
+
+      bool operator<(SplitPoint const& second) const { return distance < second.distance; }
+    };
+
+    /** New path ordered along the x axis (used by addRoads()). */
+    struct SweptPath
+    {
+      BoundingBox box;
+      size_t index;
+
+      bool operator<(SweptPath const& second) const { return box.minX() < second.box.minX(); }
+
+      /** Order of the active paths during the sweep. */
+      struct EndsBefore
+      {
+        bool operator()(SweptPath const& first, SweptPath const& second) const
+        {
+          return first.box.maxX() < second.box.maxX();
+        }
+      };
+    };
+
+    /** Crossing of two new paths (used by addRoads()). */
+    struct Crossing
+    {
+      size_t first;
+      size_t second;
+      Point position;
+    };
+
+    /**
+      Remember point where path must be split unless it's one
+      of the ends of the path.
+     */
+    void addSplitPoint(Path const& path, Point const& point, std::vector<SplitPoint>* splitPoints);
+
+    /**
+      Build new road between two intersections.
+     @return The new road.
+     */
+    Road* connectIntersections(Intersection* begining, Intersection* end, Road::Type roadType);
+
     void checkConsistence();
 
     void initialize();
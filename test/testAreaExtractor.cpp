@@ -153,4 +153,111 @@ SUITE(MCBClass)
     std::list<Block*> cycles = mcb->extractBlocks(sg, zone);
     CHECK(2 == cycles.size());
   }
-}
\ No newline at end of file
+
+  TEST(GridCycles)
+  {
+    StreetGraph *sg = new StreetGraph();
+
+    /* Nodes on the same vertical line must be walked
+       from the lowest one, or outer cycles are found. */
+    for (int i = 0; i <= 4; i++)
+    {
+      sg->addRoad(Path(LineSegment(Point(0, i*100), Point(400, i*100))));
+      sg->addRoad(Path(LineSegment(Point(i*100, 0), Point(i*100, 400))));
+    }
+
+    AreaExtractor mcb;
+    std::list<Zone*> cycles = mcb.extractZones(sg);
+    CHECK(16 == cycles.size());
+
+    double totalArea = 0;
+    for (std::list<Zone*>::iterator cycle = cycles.begin(); cycle != cycles.end(); cycle++)
+    {
+      CHECK_CLOSE(10000, (*cycle)->areaConstraints().area(), 1e-6);
+      totalArea += (*cycle)->areaConstraints().area();
+    }
+    CHECK_CLOSE(160000, totalArea, 1e-6);
+  }
+
+  TEST(ParallelComponents)
+  {
+    StreetGraph *sg = new StreetGraph();
+
+    /* Two separate grids and a filament */
+    for (int i = 0; i <= 3; i++)
+    {
+      sg->addRoad(Path(LineSegment(Point(0, i*100), Point(300, i*100))));
+      sg->addRoad(Path(LineSegment(Point(i*100, 0), Point(i*100, 300))));
+      sg->addRoad(Path(LineSegment(Point(1000, i*100), Point(1300, i*100))));
+      sg->addRoad(Path(LineSegment(Point(1000 + i*100, 0), Point(1000 + i*100, 300))));
+    }
+    sg->addRoad(Path(LineSegment(Point(500, 500), Point(600, 600))));
+
+    AreaExtractor serial;
+    std::list<Zone*> serialCycles = serial.extractZones(sg);
+
+    AreaExtractor parallel;
+    parallel.setParallel(true);
+    std::list<Zone*> parallelCycles = parallel.extractZones(sg);
+
+    CHECK_EQUAL(18, static_cast<int>(parallelCycles.size()));
+    CHECK_EQUAL(serialCycles.size(), parallelCycles.size());
+
+    /* The left grid comes first. */
+    std::list<Zone*>::iterator cycle = parallelCycles.begin();
+    for (int i = 0; i < 9; i++, cycle++)
+    {
+      CHECK((*cycle)->areaConstraints().vertex(0).x() < 500);
+    }
+
+    parallel.setRoadWidth(Road::PRIMARY_ROAD, 0.1);
+    serial.setRoadWidth(Road::PRIMARY_ROAD, 0.1);
+    CHECK_EQUAL(serial.extractBlocks(sg).size(), parallel.extractBlocks(sg).size());
+  }
+
+  TEST(WidthsByRoadType)
+  {
+    StreetGraph *sg = new StreetGraph();
+
+    sg->addRoad(Path(LineSegment(Point(0,0), Point(1000,0))), Road::SECONDARY_ROAD);
+    sg->addRoad(Path(LineSegment(Point(1000,0), Point(1000,1000))));
+    sg->addRoad(Path(LineSegment(Point(1000,1000), Point(0,1000))));
+    sg->addRoad(Path(LineSegment(Point(0,1000), Point(0,0))));
+
+    AreaExtractor mcb;
+    mcb.setRoadWidth(Road::PRIMARY_ROAD, 1);
+    mcb.setRoadWidth(Road::SECONDARY_ROAD, 1);
+    std::list<Block*> uniform = mcb.extractBlocks(sg);
+
+    mcb.setRoadWidth(Road::SECONDARY_ROAD, 0.5);
+    std::list<Block*> mixed = mcb.extractBlocks(sg);
+
+    CHECK_EQUAL(1, static_cast<int>(uniform.size()));
+    CHECK_EQUAL(1, static_cast<int>(mixed.size()));
+    CHECK(mixed.front()->areaConstraints().area() > uniform.front()->areaConstraints().area());
+  }
+
+  TEST(MissingRoadWidth)
+  {
+    StreetGraph *sg = new StreetGraph();
+
+    sg->addRoad(Path(LineSegment(Point(0,0), Point(1000,0))), Road::SECONDARY_ROAD);
+    sg->addRoad(Path(LineSegment(Point(1000,0), Point(1000,1000))));
+    sg->addRoad(Path(LineSegment(Point(1000,1000), Point(0,1000))));
+    sg->addRoad(Path(LineSegment(Point(0,1000), Point(0,0))));
+
+    AreaExtractor uniform;
+    uniform.setRoadWidth(Road::PRIMARY_ROAD, 10);
+    uniform.setRoadWidth(Road::SECONDARY_ROAD, 10);
+    std::list<Block*> expected = uniform.extractBlocks(sg);
+
+    /* Secondary road has no width, it is as wide as the primary ones. */
+    AreaExtractor missing;
+    missing.setRoadWidth(Road::PRIMARY_ROAD, 10);
+    std::list<Block*> found = missing.extractBlocks(sg);
+
+    CHECK_EQUAL(1, static_cast<int>(expected.size()));
+    CHECK_EQUAL(1, static_cast<int>(found.size()));
+    CHECK_CLOSE(expected.front()->areaConstraints().area(), found.front()->areaConstraints().area(), 1e-6);
+  }
+}
@@ -0,0 +1,94 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testBoundingBox.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of BoundingBox class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+// Tested modules
+#include "../src/geometry/boundingbox.h"
+#include "../src/geometry/point.h"
+
+SUITE(BoundingBoxClass)
+{
+  TEST(Empty)
+  {
+    BoundingBox box;
+    CHECK(box.isEmpty());
+    CHECK(!box.contains(Point(0,0)));
+    CHECK(!box.intersects(box));
+
+    box.expand(10);
+    CHECK(box.isEmpty());
+
+    box.include(Point(1,2));
+    CHECK(!box.isEmpty());
+    CHECK(box.contains(Point(1,2)));
+  }
+
+  TEST(Include)
+  {
+    BoundingBox box(Point(10,-5), Point(-10,5));
+    CHECK_EQUAL(-10, box.minX());
+    CHECK_EQUAL(-5, box.minY());
+    CHECK_EQUAL(10, box.maxX());
+    CHECK_EQUAL(5, box.maxY());
+
+    box.include(Point(20,0));
+    CHECK_EQUAL(20, box.maxX());
+
+    box.include(BoundingBox(Point(0,-20), Point(0,0)));
+    CHECK_EQUAL(-20, box.minY());
+
+    box.include(BoundingBox());
+    CHECK_EQUAL(-20, box.minY());
+    CHECK_EQUAL(20, box.maxX());
+  }
+
+  TEST(Expand)
+  {
+    BoundingBox box(Point(0,0), Point(10,10));
+    box.expand(1);
+    CHECK_EQUAL(-1, box.minX());
+    CHECK_EQUAL(-1, box.minY());
+    CHECK_EQUAL(11, box.maxX());
+    CHECK_EQUAL(11, box.maxY());
+  }
+
+  TEST(Contains)
+  {
+    BoundingBox box(Point(0,0), Point(10,10));
+    CHECK(box.contains(Point(5,5)));
+    CHECK(box.contains(Point(0,10)));
+    CHECK(!box.contains(Point(-1,5)));
+    CHECK(!box.contains(Point(5,11)));
+
+    CHECK(box.contains(BoundingBox(Point(1,1), Point(9,9))));
+    CHECK(box.contains(box));
+    CHECK(!box.contains(BoundingBox(Point(1,1), Point(19,9))));
+  }
+
+  TEST(Intersects)
+  {
+    BoundingBox box(Point(0,0), Point(10,10));
+    CHECK(box.intersects(BoundingBox(Point(5,5), Point(15,15))));
+    CHECK(box.intersects(BoundingBox(Point(10,10), Point(15,15))));
+    CHECK(box.intersects(BoundingBox(Point(-5,-5), Point(15,15))));
+    CHECK(!box.intersects(BoundingBox(Point(11,0), Point(15,10))));
+    CHECK(!box.intersects(BoundingBox(Point(0,-5), Point(10,-1))));
+  }
+}
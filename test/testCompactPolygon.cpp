@@ -0,0 +1,86 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testCompactPolygon.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of the CompactPolygon class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+// Tested modules
+#include "../src/geometry/compactpolygon.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+#include "../src/area/block.h"
+
+SUITE(CompactPolygon)
+{
+  TEST(RoundTrip)
+  {
+    Polygon p;
+    p.addVertex(Point(0, 0));
+    p.addVertex(Point(10, 0));
+    p.addVertex(Point(10, 10));
+    p.addVertex(Point(0, 10));
+
+    FloatPolygon compact(p);
+    CHECK_EQUAL(4u, compact.numberOfVertices());
+    CHECK(compact.vertex(2) == Point(10, 10));
+    CHECK_EQUAL(8*sizeof(float), compact.bytes());
+
+    Polygon restored = compact.toPolygon();
+    CHECK_EQUAL(p.numberOfVertices(), restored.numberOfVertices());
+    for (unsigned int i = 0; i < p.numberOfVertices(); i++)
+    {
+      CHECK(restored.vertex(i) == p.vertex(i));
+    }
+
+    CHECK_EQUAL(0u, FloatPolygon().numberOfVertices());
+    CHECK(FloatPolygon().data() == 0);
+  }
+
+  TEST(FarFromOrigin)
+  {
+    /* Float alone cannot tell these vertices apart at 1e7. */
+    Polygon p;
+    p.addVertex(Point(1e7, 1e7));
+    p.addVertex(Point(1e7 + 0.25, 1e7));
+    p.addVertex(Point(1e7 + 0.25, 1e7 + 0.5));
+
+    FloatPolygon compact(p);
+    CHECK(compact.origin() == Point(1e7, 1e7));
+    CHECK_CLOSE(1e7 + 0.25, compact.x(1), 1e-6);
+    CHECK_CLOSE(1e7 + 0.5, compact.y(2), 1e-6);
+    CHECK_CLOSE(0.25f, compact.data()[2], 1e-6);
+  }
+
+  TEST(ExportLots)
+  {
+    Polygon p;
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(200,0));
+    p.addVertex(Point(200,200));
+    p.addVertex(Point(0,200));
+
+    Block b(0, p);
+    b.createLots(50,50,0.0);
+
+    std::vector<FloatPolygon> borders;
+    b.exportLots(&borders);
+    CHECK_EQUAL(b.getLots().size(), borders.size());
+    CHECK(borders.size() > 0);
+  }
+}
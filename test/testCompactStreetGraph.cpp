@@ -0,0 +1,119 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testCompactStreetGraph.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of CompactStreetGraph class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+// Tested modules
+#include "../src/streetgraph/compactstreetgraph.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/path.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/point.h"
+
+SUITE(CompactStreetGraphClass)
+{
+  TEST(Empty)
+  {
+    StreetGraph sg;
+    CompactStreetGraph compact(&sg);
+
+    CHECK_EQUAL(0u, compact.numberOfIntersections());
+    CHECK_EQUAL(0u, compact.numberOfRoads());
+  }
+
+  TEST(Cross)
+  {
+    StreetGraph sg;
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(100,0))));
+    sg.addRoad(Path(LineSegment(Point(50,-50), Point(50,50))), Road::SECONDARY_ROAD);
+
+    CompactStreetGraph compact(&sg);
+    CHECK_EQUAL(5u, compact.numberOfIntersections());
+    CHECK_EQUAL(4u, compact.numberOfRoads());
+
+    int secondary = 0;
+    for (CompactStreetGraph::Index road = 0; road < compact.numberOfRoads(); road++)
+    {
+      CHECK(compact.intersection(compact.roadBegining(road)) == compact.road(road)->begining());
+      CHECK(compact.intersection(compact.roadEnd(road)) == compact.road(road)->end());
+      if (compact.roadType(road) == Road::SECONDARY_ROAD)
+      {
+        secondary++;
+      }
+    }
+    CHECK_EQUAL(2, secondary);
+
+    for (CompactStreetGraph::Index intersection = 0;
+         intersection < compact.numberOfIntersections();
+         intersection++)
+    {
+      Intersection* source = compact.intersection(intersection);
+      CHECK(compact.position(intersection) == source->position());
+      CHECK_EQUAL(source->numberOfWays(), (int) compact.degree(intersection));
+
+      for (CompactStreetGraph::Index adjacency = compact.adjacencyBegin(intersection);
+           adjacency != compact.adjacencyEnd(intersection);
+           adjacency++)
+      {
+        CompactStreetGraph::Index road = compact.adjacentRoad(adjacency);
+        CompactStreetGraph::Index neighbor = compact.neighbor(adjacency);
+        CHECK(source->hasRoad(compact.road(road)));
+        CHECK(neighbor != intersection);
+        CHECK(compact.intersection(neighbor)->hasRoad(compact.road(road)));
+      }
+    }
+
+    CompactStreetGraph::Index center = 0;
+    while (compact.degree(center) != 4)
+    {
+      center++;
+    }
+    CHECK_CLOSE(50, compact.x(center), 1e-9);
+    CHECK_CLOSE(0, compact.y(center), 1e-9);
+  }
+
+  TEST(Part)
+  {
+    StreetGraph sg;
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(100,0))));
+    sg.addRoad(Path(LineSegment(Point(50,-50), Point(50,50))), Road::SECONDARY_ROAD);
+
+    /* The center and both ends of the secondary road. */
+    std::vector<Intersection*> part;
+    part.push_back(sg.getIntersectionAtPosition(Point(50,50)));
+    part.push_back(sg.getIntersectionAtPosition(Point(50,0)));
+    part.push_back(sg.getIntersectionAtPosition(Point(50,-50)));
+
+    CompactStreetGraph compact(part);
+    CHECK_EQUAL(3u, compact.numberOfIntersections());
+    CHECK_EQUAL(2u, compact.numberOfRoads());
+    CHECK(compact.intersection(1) == part[1]);
+    CHECK_EQUAL(2u, compact.degree(1));
+    CHECK_EQUAL(1u, compact.degree(0));
+    CHECK_EQUAL(1u, compact.degree(2));
+
+    for (CompactStreetGraph::Index road = 0; road < compact.numberOfRoads(); road++)
+    {
+      CHECK_EQUAL(Road::SECONDARY_ROAD, compact.roadType(road));
+      CHECK(compact.intersection(compact.roadBegining(road)) == compact.road(road)->begining());
+    }
+  }
+}
@@ -0,0 +1,188 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testFaceIndex.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of the FaceIndex class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <list>
+#include <vector>
+
+// Tested modules
+#include "../src/streetgraph/faceindex.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/path.h"
+#include "../src/area/zone.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/linesegment.h"
+
+namespace
+{
+  void addSquare(StreetGraph* graph)
+  {
+    graph->addRoad(Path(LineSegment(Point(0,0), Point(100,0))));
+    graph->addRoad(Path(LineSegment(Point(100,0), Point(100,100))));
+    graph->addRoad(Path(LineSegment(Point(100,100), Point(0,100))));
+    graph->addRoad(Path(LineSegment(Point(0,100), Point(0,0))));
+  }
+
+  double totalArea(std::list<Zone*> const& zones)
+  {
+    double area = 0;
+    for (std::list<Zone*>::const_iterator zone = zones.begin(); zone != zones.end(); zone++)
+    {
+      area += (*zone)->areaConstraints().area();
+      delete *zone;
+    }
+    return area;
+  }
+}
+
+SUITE(FaceIndex)
+{
+  TEST(SquareAndDiagonal)
+  {
+    StreetGraph graph;
+    graph.trackFaces(true);
+    addSquare(&graph);
+
+    std::list<Zone*> zones = graph.findFaceZones();
+    CHECK_EQUAL(1u, zones.size());
+    CHECK_EQUAL(4u, zones.front()->areaConstraints().numberOfVertices());
+    CHECK_CLOSE(10000, totalArea(zones), 1e-6);
+
+    std::vector<FaceIndex::Face> created, destroyed;
+    graph.takeFaceChanges(&created, &destroyed);
+    CHECK_EQUAL(2u, created.size());
+    CHECK_EQUAL(0u, destroyed.size());
+
+    /* Diagonal splits the inner face only. */
+    graph.addRoad(Path(LineSegment(Point(0,0), Point(100,100))));
+    graph.takeFaceChanges(&created, &destroyed);
+    CHECK_EQUAL(2u, created.size());
+    CHECK_EQUAL(1u, destroyed.size());
+
+    zones = graph.findFaceZones(created);
+    CHECK_EQUAL(2u, zones.size());
+    CHECK_CLOSE(10000, totalArea(zones), 1e-6);
+
+    /* Removing it merges them again. */
+    Road* diagonal = graph.getRoadBetweenIntersections(graph.getIntersectionAtPosition(Point(0,0)),
+                                                       graph.getIntersectionAtPosition(Point(100,100)));
+    CHECK(diagonal != 0);
+    graph.removeRoad(diagonal);
+    graph.takeFaceChanges(&created, &destroyed);
+    CHECK_EQUAL(1u, created.size());
+    CHECK_EQUAL(2u, destroyed.size());
+    zones = graph.findFaceZones();
+    CHECK_EQUAL(1u, zones.size());
+    CHECK_CLOSE(10000, totalArea(zones), 1e-6);
+  }
+
+  TEST(FilamentsAndSplitRoads)
+  {
+    StreetGraph graph;
+    graph.trackFaces(true);
+    addSquare(&graph);
+
+    /* Dead end inside and a road going out */
+    graph.addRoad(Path(LineSegment(Point(0,50), Point(40,50))));
+    graph.addRoad(Path(LineSegment(Point(100,50), Point(200,50))));
+
+    std::list<Zone*> zones = graph.findFaceZones();
+    CHECK_EQUAL(1u, zones.size());
+    CHECK_EQUAL(6u, zones.front()->areaConstraints().numberOfVertices());
+    CHECK_CLOSE(10000, totalArea(zones), 1e-6);
+
+    /* Road crossing the square is split into three. */
+    graph.addRoad(Path(LineSegment(Point(60,-50), Point(60,150))));
+    zones = graph.findFaceZones();
+    CHECK_EQUAL(2u, zones.size());
+    CHECK_CLOSE(10000, totalArea(zones), 1e-6);
+  }
+
+  TEST(HoleAndGrid)
+  {
+    StreetGraph graph;
+    graph.trackFaces(true);
+    addSquare(&graph);
+
+    /* Separate block inside the square */
+    graph.addRoad(Path(LineSegment(Point(40,40), Point(60,40))));
+    graph.addRoad(Path(LineSegment(Point(60,40), Point(60,60))));
+    graph.addRoad(Path(LineSegment(Point(60,60), Point(40,60))));
+    graph.addRoad(Path(LineSegment(Point(40,60), Point(40,40))));
+
+    std::list<Zone*> zones = graph.findFaceZones();
+    CHECK_EQUAL(2u, zones.size());
+    CHECK_CLOSE(10400, totalArea(zones), 1e-6);
+
+    StreetGraph grid;
+    for (int i = 0; i <= 5; i++)
+    {
+      grid.addRoad(Path(LineSegment(Point(0, i*100.0), Point(500, i*100.0))));
+      grid.addRoad(Path(LineSegment(Point(i*100.0, 0), Point(i*100.0, 500))));
+    }
+    grid.addRoad(Path(LineSegment(Point(-50, -30), Point(570, 533))));
+
+    /* Faces of the finished grid indexed at once. */
+    zones = grid.findFaceZones();
+    CHECK(zones.empty());
+    grid.trackFaces(true);
+    zones = grid.findFaceZones();
+    CHECK_EQUAL(34u, zones.size());
+    CHECK_CLOSE(250000, totalArea(zones), 1e-3);
+  }
+
+  TEST(LargeLadder)
+  {
+    /* Two long rails joined by rungs, the rails are split by every
+       rung. Built road by road without tracking, then indexed at
+       once. Tracking the faces all the way would retrace the outer
+       face along the whole ladder after every road. */
+    const int rungs = 8000;
+    StreetGraph ladder;
+    ladder.addRoad(Path(LineSegment(Point(0,0), Point((rungs - 1)*10.0, 0))));
+    ladder.addRoad(Path(LineSegment(Point(0,10), Point((rungs - 1)*10.0, 10))));
+    for (int i = 0; i < rungs; i++)
+    {
+      ladder.addRoad(Path(LineSegment(Point(i*10.0, 0), Point(i*10.0, 10))));
+    }
+    CHECK_EQUAL(3*rungs - 2, ladder.numberOfRoads());
+
+    ladder.trackFaces(true);
+    std::vector<FaceIndex::Face> created, destroyed;
+    ladder.takeFaceChanges(&created, &destroyed);
+    CHECK_EQUAL(rungs + 0u, created.size());
+    CHECK_EQUAL(0u, destroyed.size());
+
+    std::list<Zone*> zones = ladder.findFaceZones();
+    CHECK_EQUAL(rungs - 1u, zones.size());
+    CHECK_CLOSE((rungs - 1)*100.0, totalArea(zones), 1e-3);
+
+    /* Edits keep the index up to date from now on. The rung splits
+       the first face and the ends of the rails change the outer one. */
+    ladder.addRoad(Path(LineSegment(Point(5,0), Point(5,10))));
+    ladder.takeFaceChanges(&created, &destroyed);
+    CHECK_EQUAL(3u, created.size());
+    CHECK_EQUAL(2u, destroyed.size());
+
+    ladder.trackFaces(false);
+    CHECK(ladder.findFaceZones().empty());
+  }
+}
@@ -0,0 +1,57 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testKernel.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of geometric kernel functions
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+// Tested modules
+#include "../src/geometry/kernel.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/vector.h"
+
+SUITE(Kernel)
+{
+  TEST(Orientation)
+  {
+    CHECK(libcity::orient2d(0,0, 10,0, 5,5) > 0);
+    CHECK(libcity::orient2d(0,0, 10,0, 5,-5) < 0);
+    CHECK_EQUAL(0, libcity::orient2d(0,0, 10,0, 20,0));
+    CHECK_EQUAL(100, libcity::orient2d(0,0, 10,0, 0,10));
+  }
+
+  TEST(Products)
+  {
+    CHECK_EQUAL(11, libcity::dot2D(1,2, 3,4));
+    CHECK_EQUAL(32, libcity::dot3D(1,2,3, 4,5,6));
+    CHECK_EQUAL(-2, libcity::cross2D(1,2, 3,4));
+    CHECK_EQUAL(25, libcity::squaredDistance2D(1,1, 4,5));
+    CHECK_EQUAL(27, libcity::squaredDistance3D(0,0,0, 3,3,3));
+  }
+
+  TEST(VectorWrappers)
+  {
+    Vector first(1,2), second(3,4);
+    CHECK_EQUAL(libcity::cross2D(1,2, 3,4), first.perpDotProduct(second));
+    CHECK_EQUAL(libcity::dot2D(1,2, 3,4), first.dotProduct(second));
+
+    Point a(1,1), b(4,5);
+    CHECK_EQUAL(5, Vector(a, b).length());
+    CHECK((a + Vector(a, b)) == b);
+    CHECK((b - a) == Vector(3,4));
+  }
+}
@@ -0,0 +1,63 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testObjectPool.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of ObjectPool class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <new>
+#include <set>
+
+// Tested modules
+#include "../src/streetgraph/objectpool.h"
+#include "../src/geometry/point.h"
+
+SUITE(ObjectPoolClass)
+{
+  TEST(Allocation)
+  {
+    ObjectPool<Point> pool(4);
+    CHECK_EQUAL(0u, pool.numberOfSlabs());
+
+    std::set<Point*> points;
+    for (int i = 0; i < 10; i++)
+    {
+      points.insert(new (pool.allocate()) Point(i, i));
+    }
+
+    CHECK_EQUAL(10u, points.size());
+    CHECK_EQUAL(10u, pool.numberOfObjects());
+    CHECK_EQUAL(3u, pool.numberOfSlabs());
+  }
+
+  TEST(Reuse)
+  {
+    ObjectPool<Point> pool(4);
+
+    Point* first = new (pool.allocate()) Point(1, 2);
+    Point* second = new (pool.allocate()) Point(3, 4);
+    CHECK_EQUAL(4, second->y());
+
+    first->~Point();
+    pool.release(first);
+    CHECK_EQUAL(1u, pool.numberOfObjects());
+
+    Point* third = new (pool.allocate()) Point(5, 6);
+    CHECK(third == first);
+    CHECK_EQUAL(3, second->x());
+    CHECK_EQUAL(1u, pool.numberOfSlabs());
+  }
+}
@@ -0,0 +1,110 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testOrientedBox.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of the OrientedBox class and convex hull
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cmath>
+
+// Tested modules
+#include "../src/geometry/orientedbox.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/vector.h"
+#include "../src/area/block.h"
+
+SUITE(OrientedBox)
+{
+  TEST(ConvexHull)
+  {
+    Polygon p;
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(10,0));
+    p.addVertex(Point(10,5));
+    p.addVertex(Point(5,5));
+    p.addVertex(Point(5,10));
+    p.addVertex(Point(0,10));
+
+    Polygon hull = p.convexHull();
+    CHECK_EQUAL(5u, hull.numberOfVertices());
+    CHECK(hull.vertex(0) == Point(0,0));
+    CHECK(hull.vertex(1) == Point(10,0));
+    CHECK(hull.vertex(2) == Point(10,5));
+    CHECK(hull.vertex(3) == Point(5,10));
+    CHECK(hull.vertex(4) == Point(0,10));
+  }
+
+  TEST(RotatedRectangle)
+  {
+    Vector axis(std::cos(M_PI/6), std::sin(M_PI/6));
+    Vector normal(-axis.y(), axis.x());
+    Point center(100, 50);
+
+    Polygon p;
+    p.addVertex(center + axis*(-10) + normal*(-5));
+    p.addVertex(center + axis*10 + normal*(-5));
+    p.addVertex(center + axis*10 + normal*5);
+    p.addVertex(center + normal*3);
+    p.addVertex(center + axis*(-10) + normal*5);
+
+    OrientedBox box(p);
+    CHECK(!box.isEmpty());
+    CHECK(box.center() == center);
+    CHECK_CLOSE(20, box.length(), 1e-9);
+    CHECK_CLOSE(10, box.width(), 1e-9);
+    CHECK_CLOSE(1, std::abs(box.axis().dotProduct(axis)), 1e-9);
+
+    Polygon hull = p.convexHull();
+    CHECK_EQUAL(4u, hull.numberOfVertices());
+    for (unsigned int i = 0; i < 4; i++)
+    {
+      bool isCorner = false;
+      for (unsigned int j = 0; j < 4; j++)
+      {
+        isCorner = isCorner || box.corner(i) == hull.vertex(j);
+      }
+      CHECK(isCorner);
+    }
+  }
+
+  TEST(Degenerate)
+  {
+    CHECK(OrientedBox().isEmpty());
+    CHECK(OrientedBox(Polygon()).isEmpty());
+
+    Polygon segment;
+    segment.addVertex(Point(0,0));
+    segment.addVertex(Point(0,8));
+    OrientedBox box(segment);
+    CHECK_CLOSE(8, box.length(), 1e-9);
+    CHECK_CLOSE(0, box.width(), 1e-9);
+    CHECK(box.center() == Point(0,4));
+  }
+
+  TEST(CachedInArea)
+  {
+    Block b(0, Polygon(Point(0,0), Point(30,0), Point(30,10), Point(0,10)));
+    CHECK_CLOSE(30, b.orientedBox().length(), 1e-9);
+
+    b.setAreaConstraints(Polygon(Point(0,0), Point(10,0), Point(10,50), Point(0,50)));
+    CHECK_CLOSE(50, b.orientedBox().length(), 1e-9);
+    CHECK_CLOSE(1, std::abs(b.orientedBox().axis().y()), 1e-9);
+
+    Block copy(b);
+    CHECK_CLOSE(10, copy.orientedBox().width(), 1e-9);
+  }
+}
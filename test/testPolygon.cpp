@@ -60,6 +60,23 @@ SUITE(PolygonClass)
     delete p;
   }
 
+  TEST(Copy)
+  {
+    Polygon original(Point(0,0), Point(10,0), Point(10,10), Point(0,10));
+    Polygon copy(original);
+    Polygon assigned;
+    assigned = original;
+
+    copy.updateVertex(0, Point(-5,-5));
+    assigned.removeVertex(3);
+
+    CHECK(original.vertex(0) == Point(0,0));
+    CHECK_EQUAL(4u, original.numberOfVertices());
+    CHECK(copy.vertex(0) == Point(-5,-5));
+    CHECK_EQUAL(3u, assigned.numberOfVertices());
+    CHECK(assigned.vertex(2) == Point(10,10));
+  }
+
   TEST(centroid)
   {
     Polygon *p = new Polygon();
@@ -87,6 +104,49 @@ SUITE(PolygonClass)
     delete p;
   }
 
+  TEST(BoundingBox)
+  {
+    Polygon p;
+    CHECK(p.aabb().isEmpty());
+
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(10,0));
+    p.addVertex(Point(10,10));
+    p.addVertex(Point(0,10));
+    CHECK_EQUAL(10, p.aabb().maxX());
+
+    p.updateVertex(2, Point(20,5));
+    CHECK_EQUAL(20, p.aabb().maxX());
+    CHECK_EQUAL(10, p.aabb().maxY());
+
+    /* Border vertex moves inside, the box shrinks. */
+    p.updateVertex(2, Point(5,5));
+    CHECK_EQUAL(10, p.aabb().maxX());
+
+    p.removeVertex(1);
+    CHECK_EQUAL(5, p.aabb().maxX());
+
+    Polygon copy(p);
+    CHECK_EQUAL(5, copy.aabb().maxX());
+
+    CHECK(!p.encloses2D(Point(100, 100)));
+
+    p.clear();
+    CHECK(p.aabb().isEmpty());
+  }
+
+  TEST(SplitOutOfBox)
+  {
+    Polygon p(Point(0,0), Point(10,0), Point(10,10), Point(0,10));
+
+    Line line(Point(20,0), Point(20,1));
+    std::list<Polygon*> newOnes = p.split(line);
+    CHECK_EQUAL(1u, newOnes.size());
+    CHECK_EQUAL(4u, newOnes.front()->numberOfVertices());
+    CHECK(newOnes.front()->vertex(2) == p.vertex(2));
+    delete newOnes.front();
+  }
+
   TEST(EdgeAccess)
   {
     Polygon p;
@@ -149,6 +209,29 @@ SUITE(PolygonClass)
     CHECK(Vector(0,1,0) == p.edgeNormal(0));
   }
 
+  TEST(EdgeNormalAfterUpdate)
+  {
+    Polygon p;
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(10,0));
+    p.addVertex(Point(10,10));
+    p.addVertex(Point(0,10));
+
+    CHECK(p.isCounterclockwise());
+    CHECK(Vector(0,1) == p.edgeNormal(0));
+
+    /* Concave vertex must not change normals of other edges. */
+    p.updateVertex(2, Point(5,2));
+    CHECK(Vector(0,1) == p.edgeNormal(0));
+    CHECK(Vector(1,0) == p.edgeNormal(3));
+
+    p.updateVertex(1, Point(0,10));
+    p.updateVertex(3, Point(10,0));
+    p.updateVertex(2, Point(10,10));
+    CHECK(!p.isCounterclockwise());
+    CHECK(Vector(1,0) == p.edgeNormal(0));
+  }
+
   TEST(ZRotation)
   {
     Polygon p;
@@ -255,6 +338,29 @@ SUITE(PolygonClass)
     CHECK(!p.isNonSelfIntersecting());
   }
 
+  TEST(IsSimpleReportsEdges)
+  {
+    Polygon p;
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(10,0));
+    p.addVertex(Point(10,10));
+    p.addVertex(Point(0,10));
+
+    unsigned int first = 100, second = 100;
+    CHECK(p.isNonSelfIntersecting(&first, &second));
+    CHECK_EQUAL(100u, first);
+
+    /* Folded back over the previous edge */
+    p.addVertex(Point(0,5));
+    p.addVertex(Point(0,12));
+    CHECK(!p.isNonSelfIntersecting(&first, &second));
+
+    Polygon bowTie(Point(0,0), Point(10,10), Point(10,0), Point(0,10));
+    CHECK(!bowTie.isNonSelfIntersecting(&first, &second));
+    CHECK_EQUAL(0u, first);
+    CHECK_EQUAL(2u, second);
+  }
+
   TEST(Triangulation)
   {
     Polygon p;
@@ -0,0 +1,94 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testPolygonOffset.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of the PolygonOffset class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+// Tested modules
+#include "../src/geometry/polygonoffset.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+
+SUITE(PolygonOffset)
+{
+  TEST(DifferentDistances)
+  {
+    Polygon p;
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(10,0));
+    p.addVertex(Point(10,10));
+    p.addVertex(Point(0,10));
+
+    std::vector<double> distances;
+    distances.push_back(1);
+    distances.push_back(2);
+    distances.push_back(3);
+    distances.push_back(4);
+
+    PolygonOffset offset;
+    CHECK(offset.offset(&p, distances));
+    CHECK_EQUAL(4u, p.numberOfVertices());
+    CHECK(p.vertex(0) == Point(4,1));
+    CHECK(p.vertex(1) == Point(8,1));
+    CHECK(p.vertex(2) == Point(8,7));
+    CHECK(p.vertex(3) == Point(4,7));
+  }
+
+  TEST(ShortEdgeCollapses)
+  {
+    Polygon p;
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(100,0));
+    p.addVertex(Point(100,18));
+    p.addVertex(Point(98,20));
+    p.addVertex(Point(0,20));
+
+    std::vector<double> distances(5, 5);
+
+    PolygonOffset offset;
+    CHECK(offset.offset(&p, distances));
+    CHECK_EQUAL(4u, p.numberOfVertices());
+    CHECK(p.vertex(0) == Point(5,5));
+    CHECK(p.vertex(1) == Point(95,5));
+    CHECK(p.vertex(2) == Point(95,15));
+    CHECK(p.vertex(3) == Point(5,15));
+    CHECK(p.isNonSelfIntersecting());
+  }
+
+  TEST(WholePolygonCollapses)
+  {
+    Polygon p;
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(10,0));
+    p.addVertex(Point(10,10));
+    p.addVertex(Point(0,10));
+
+    PolygonOffset offset;
+    CHECK(!offset.offset(&p, std::vector<double>(4, 6)));
+    CHECK_EQUAL(4u, p.numberOfVertices());
+    CHECK(p.vertex(2) == Point(10,10));
+
+    /* The same instance can be reused. */
+    CHECK(offset.offset(&p, std::vector<double>(4, 2)));
+    CHECK(p.vertex(0) == Point(2,2));
+
+    p.substract(5);
+    CHECK_EQUAL(0u, p.numberOfVertices());
+  }
+}
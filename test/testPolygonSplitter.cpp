@@ -0,0 +1,76 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testPolygonSplitter.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of the PolygonSplitter class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+// Tested modules
+#include "../src/geometry/polygonsplitter.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/line.h"
+#include "../src/geometry/point.h"
+
+SUITE(PolygonSplitter)
+{
+  TEST(SplitSquare)
+  {
+    Polygon p(Point(0,0), Point(10,0), Point(10,10), Point(0,10));
+
+    PolygonSplitter splitter;
+    std::vector<Polygon> pieces;
+    CHECK_EQUAL(2u, splitter.split(p, Line(Point(4,0), Point(4,1)), &pieces));
+    CHECK_EQUAL(4u, pieces[0].numberOfVertices());
+    CHECK_EQUAL(4u, pieces[1].numberOfVertices());
+    CHECK_CLOSE(100, pieces[0].area() + pieces[1].area(), 1e-6);
+
+    /* Line out of the polygon gives a copy, the buffer is reused. */
+    CHECK_EQUAL(1u, splitter.split(p, Line(Point(20,0), Point(20,1)), &pieces));
+    CHECK_EQUAL(2u, pieces.size());
+    CHECK(pieces[0].vertex(2) == Point(10,10));
+
+    /* Touching a vertex only */
+    CHECK_EQUAL(1u, splitter.split(p, Line(Point(-1,1), Point(1,-1)), &pieces));
+  }
+
+  TEST(SplitConcave)
+  {
+    Polygon p;
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(30,0));
+    p.addVertex(Point(30,20));
+    p.addVertex(Point(20,20));
+    p.addVertex(Point(20,10));
+    p.addVertex(Point(10,10));
+    p.addVertex(Point(10,20));
+    p.addVertex(Point(0,20));
+
+    PolygonSplitter splitter;
+    std::vector<Polygon> pieces;
+    unsigned int count = splitter.split(p, Line(Point(0,15), Point(1,15)), &pieces);
+    CHECK_EQUAL(3u, count);
+
+    double area = 0;
+    for (unsigned int i = 0; i < count; i++)
+    {
+      area += pieces[i].area();
+      CHECK(pieces[i].isNonSelfIntersecting());
+    }
+    CHECK_CLOSE(500, area, 1e-6);
+  }
+}
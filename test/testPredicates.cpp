@@ -0,0 +1,104 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testPredicates.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of robust geometric predicates
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cstdlib>
+
+// Tested modules
+#include "../src/geometry/predicates.h"
+
+namespace
+{
+  int sign(double value)
+  {
+    return (value > 0) - (value < 0);
+  }
+}
+
+SUITE(Predicates)
+{
+  TEST(Orientation)
+  {
+    CHECK(libcity::orient2dRobust(0,0, 10,0, 5,5) > 0);
+    CHECK(libcity::orient2dRobust(0,0, 10,0, 5,-5) < 0);
+    CHECK_EQUAL(0, libcity::orient2dRobust(0,0, 10,0, 20,0));
+  }
+
+  TEST(OrientationOfCollinearPoints)
+  {
+    /* Doubling is exact, so these lie on y = 2x. */
+    double x[] = {0.1, 0.3, 0.7, 1e7 + 0.1, 3.3};
+    for (int i = 0; i < 3; i++)
+    {
+      CHECK_EQUAL(0, libcity::orient2dRobust(x[i], 2*x[i], x[i+1], 2*x[i+1], x[i+2], 2*x[i+2]));
+    }
+  }
+
+  TEST(OrientationIsConsistent)
+  {
+    std::srand(11);
+
+    /* Nearly collinear points, where plain floating point
+       gives different signs for permutations of the same points. */
+    for (int i = 0; i < 2000; i++)
+    {
+      double t = (std::rand() % 1000) / 997.0;
+      double ax = 0.5, ay = 0.5,
+             bx = 12.0 + (std::rand() % 3 - 1)*1e-15, by = 12.0,
+             cx = 0.5 + t*11.5, cy = 0.5 + t*11.5;
+
+      int first  = sign(libcity::orient2dRobust(ax, ay, bx, by, cx, cy));
+      int second = sign(libcity::orient2dRobust(bx, by, cx, cy, ax, ay));
+      int third  = sign(libcity::orient2dRobust(cx, cy, ax, ay, bx, by));
+      int swapped = sign(libcity::orient2dRobust(bx, by, ax, ay, cx, cy));
+
+      CHECK_EQUAL(first, second);
+      CHECK_EQUAL(first, third);
+      CHECK_EQUAL(first, -swapped);
+    }
+  }
+
+  TEST(Incircle)
+  {
+    CHECK(libcity::incircleRobust(1,0, 0,1, -1,0, 0,0) > 0);
+    CHECK(libcity::incircleRobust(1,0, 0,1, -1,0, 5,5) < 0);
+    CHECK_EQUAL(0, libcity::incircleRobust(1,0, 0,1, -1,0, 0,-1));
+
+    /* Far from the origin the plain evaluation loses the bits. */
+    double offset = 1e9;
+    CHECK_EQUAL(0, libcity::incircleRobust(offset + 1, offset, offset, offset + 1,
+                                           offset - 1, offset, offset, offset - 1));
+    CHECK(libcity::incircleRobust(offset + 1, offset, offset, offset + 1,
+                                  offset - 1, offset, offset, offset - 0.999999) > 0);
+  }
+
+  TEST(CounterclockwiseOrder)
+  {
+    CHECK(libcity::isCounterclockwiseBefore(0,0, 1,0, 0,1));
+    CHECK(libcity::isCounterclockwiseBefore(0,0, -1,0, 0,-1));
+    CHECK(libcity::isCounterclockwiseBefore(0,0, 0,-1, 1,-1));
+    CHECK(!libcity::isCounterclockwiseBefore(0,0, 1,-1, 1,0));
+
+    /* Directions differing far below the precision of their angles */
+    double huge = 1e17;
+    CHECK(libcity::isCounterclockwiseBefore(0,0, huge,1, huge,2));
+    CHECK(!libcity::isCounterclockwiseBefore(0,0, huge,2, huge,1));
+    CHECK(libcity::isCounterclockwiseBefore(0,0, 1e-300,-1, 2e-300,-1));
+  }
+}
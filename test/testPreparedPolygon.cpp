@@ -0,0 +1,90 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testPreparedPolygon.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of the PreparedPolygon class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cstdlib>
+#include <vector>
+
+// Tested modules
+#include "../src/geometry/preparedpolygon.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+
+SUITE(PreparedPolygon)
+{
+  TEST(Encloses)
+  {
+    Polygon square(Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10));
+    PreparedPolygon prepared(square);
+
+    CHECK_EQUAL(4u, prepared.numberOfEdges());
+    CHECK(prepared.encloses2D(Point(5, 5)));
+    CHECK(prepared.encloses2D(Point(10, 5)));
+    CHECK(prepared.encloses2D(Point(0, 0)));
+    CHECK(!prepared.encloses2D(Point(15, 5)));
+    CHECK(!prepared.encloses2D(Point(-5, -5)));
+  }
+
+  TEST(Batch)
+  {
+    Polygon square(Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10));
+    PreparedPolygon prepared(square);
+
+    std::vector<Point> points;
+    points.push_back(Point(5, 5));
+    points.push_back(Point(15, 5));
+    points.push_back(Point(0, 5));
+    std::vector<bool> results;
+
+    CHECK_EQUAL(2u, prepared.enclosesBatch(points, &results));
+    CHECK_EQUAL(3u, results.size());
+    CHECK(results[0]);
+    CHECK(!results[1]);
+    CHECK(results[2]);
+  }
+
+  TEST(MatchesPolygon)
+  {
+    std::srand(7);
+
+    /* Concave polygon with horizontal and vertical edges. */
+    Polygon polygon;
+    polygon.addVertex(Point(0, 0));
+    polygon.addVertex(Point(20, 0));
+    polygon.addVertex(Point(20, 20));
+    polygon.addVertex(Point(10, 5));
+    polygon.addVertex(Point(0, 20));
+    polygon.addVertex(Point(5, 10));
+    PreparedPolygon prepared(polygon);
+
+    std::vector<Point> points;
+    for (int i = 0; i < 2000; i++)
+    {
+      points.push_back(Point((std::rand() % 100) / 4.0 - 2, (std::rand() % 100) / 4.0 - 2));
+    }
+
+    std::vector<bool> results;
+    prepared.enclosesBatch(points, &results);
+    for (unsigned int i = 0; i < points.size(); i++)
+    {
+      CHECK_EQUAL(polygon.encloses2D(points[i]), prepared.encloses2D(points[i]));
+      CHECK_EQUAL(polygon.encloses2D(points[i]), (bool) results[i]);
+    }
+  }
+}
@@ -0,0 +1,83 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testQuantizedPoint.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of the QuantizedPoint class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <map>
+
+// Tested modules
+#include "../src/geometry/quantizedpoint.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/units.h"
+
+SUITE(QuantizedPoint)
+{
+  TEST(Quantize)
+  {
+    QuantizedPoint point(Point(1.5*libcity::LATTICE_STEP, -0.5*libcity::LATTICE_STEP));
+    CHECK_EQUAL(1, point.x());
+    CHECK_EQUAL(-1, point.y());
+    CHECK_EQUAL(0, point.z());
+
+    QuantizedPoint meters(Point(2*libcity::METERS, 0), libcity::METER);
+    CHECK_EQUAL(2, meters.x());
+    CHECK(meters.toPoint(libcity::METER) == Point(2.5*libcity::METERS, 0.5*libcity::METERS, 0.5*libcity::METERS));
+  }
+
+  TEST(Comparison)
+  {
+    QuantizedPoint a(1, 2, 3), b(1, 2, 3), c(1, 3, 0);
+
+    CHECK(a == b);
+    CHECK(a != c);
+    CHECK(a < c);
+    CHECK(!(c < a));
+  }
+
+  TEST(Hash)
+  {
+    QuantizedPoint a(Point(100, 200)), b(Point(100, 200)), c(Point(200, 100));
+    CHECK(a == b);
+    CHECK_EQUAL(a.hash(), b.hash());
+    CHECK_EQUAL(QuantizedPoint(-5, 7, 0).hash(), QuantizedPoint(-5, 7, 0).hash());
+
+    /* Swapped coordinates are told apart. */
+    CHECK(a.hash() != c.hash());
+  }
+
+  TEST(EqualPointsAreNeighbours)
+  {
+    Point first(10.00004, 5), second(9.99996, 5);
+    CHECK(first == second);
+
+    QuantizedPoint a(first), b(second);
+    CHECK(a.x() - b.x() <= 1 && b.x() - a.x() <= 1);
+    CHECK_EQUAL(a.y(), b.y());
+  }
+
+  TEST(MapKey)
+  {
+    std::map<QuantizedPoint, int> positions;
+    positions[QuantizedPoint(Point(100, 200))] = 1;
+    positions[QuantizedPoint(Point(100, 200))]++;
+    positions[QuantizedPoint(Point(200, 100))] = 5;
+
+    CHECK_EQUAL(2u, positions.size());
+    CHECK_EQUAL(2, positions[QuantizedPoint(Point(100, 200))]);
+  }
+}
@@ -0,0 +1,108 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testSegmentBatch.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of the SegmentBatch class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cstdlib>
+#include <vector>
+
+// Tested modules
+#include "../src/geometry/segmentbatch.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/point.h"
+
+SUITE(SegmentBatch)
+{
+  TEST(Storage)
+  {
+    SegmentBatch batch;
+    CHECK_EQUAL(0u, batch.size());
+
+    batch.add(Point(1, 2), Point(3, 4));
+    batch.add(LineSegment(Point(5, 6), Point(7, 8)));
+    CHECK_EQUAL(2u, batch.size());
+    CHECK(batch.segment(1).begining() == Point(5, 6));
+    CHECK(batch.segment(1).end() == Point(7, 8));
+
+    batch.clear();
+    CHECK_EQUAL(0u, batch.size());
+  }
+
+  TEST(Candidates)
+  {
+    SegmentBatch batch;
+    batch.add(Point(0, -10), Point(0, 10));   /* crossing */
+    batch.add(Point(100, 0), Point(200, 0));  /* far away */
+    batch.add(Point(-10, 5), Point(10, 5));   /* parallel */
+    batch.add(Point(5, 0), Point(20, 0));     /* overlaping */
+    batch.add(Point(10, 0), Point(10, 10));   /* touching */
+
+    std::vector<SegmentBatch::MaskWord> candidates;
+    LineSegment tested(Point(-10, 0), Point(10, 0));
+    CHECK_EQUAL(3u, batch.findCandidates(tested, &candidates));
+    CHECK(SegmentBatch::isCandidate(candidates, 0));
+    CHECK(!SegmentBatch::isCandidate(candidates, 1));
+    CHECK(!SegmentBatch::isCandidate(candidates, 2));
+    CHECK(SegmentBatch::isCandidate(candidates, 3));
+    CHECK(SegmentBatch::isCandidate(candidates, 4));
+
+    Point intersection;
+    CHECK_EQUAL(LineSegment::INTERSECTING, batch.intersection2D(tested, 0, &intersection));
+    CHECK(intersection == Point(0, 0));
+    CHECK_EQUAL(LineSegment::OVERLAPING, batch.intersection2D(tested, 3, &intersection));
+  }
+
+  TEST(MatchesExactTest)
+  {
+    std::srand(42);
+
+    /* Small coordinates make touching and collinear segments common. */
+    SegmentBatch batch;
+    for (int i = 0; i < 1001; i++)
+    {
+      batch.add(Point(std::rand() % 21, std::rand() % 21),
+                Point(std::rand() % 21, std::rand() % 21));
+    }
+
+    std::vector<SegmentBatch::MaskWord> candidates;
+    Point intersection;
+    for (int test = 0; test < 200; test++)
+    {
+      LineSegment tested(Point(std::rand() % 21, std::rand() % 21),
+                         Point(std::rand() % 21, std::rand() % 21));
+      if (tested.begining() == tested.end())
+      {
+        continue;
+      }
+      batch.findCandidates(tested, &candidates);
+
+      for (size_t index = 0; index < batch.size(); index++)
+      {
+        if (batch.segment(index).begining() == batch.segment(index).end())
+        {
+          continue;
+        }
+
+        if (batch.intersection2D(tested, index, &intersection) != LineSegment::NONINTERSECTING)
+        {
+          CHECK(SegmentBatch::isCandidate(candidates, index));
+        }
+      }
+    }
+  }
+}
@@ -26,6 +26,9 @@
 #include "../src/geometry/point.h"
 #include "../src/geometry/linesegment.h"
 #include "../src/streetgraph/path.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/geometry/units.h"
+#include "../src/geometry/boundingbox.h"
 
 SUITE(StreetGraphClass)
 {
@@ -36,4 +39,213 @@ SUITE(StreetGraphClass)
     sg->addRoad(Path(LineSegment(Point(-3000, -2509.3, 0), Point(-3000, -2244.59, 0))));
     sg->addRoad(Path(LineSegment(Point(-3000, 837.305, 0), Point(-3000, -2509.3, 0))));*/
   }
-}
\ No newline at end of file
+
+  TEST(IntersectionAtPosition)
+  {
+    StreetGraph sg;
+
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(100,0))));
+    sg.addRoad(Path(LineSegment(Point(100,0), Point(100,100))));
+
+    CHECK(sg.isIntersectionAtPosition(Point(0,0)));
+    CHECK(sg.isIntersectionAtPosition(Point(100,0)));
+    CHECK(sg.isIntersectionAtPosition(Point(100,100)));
+    CHECK(!sg.isIntersectionAtPosition(Point(50,0)));
+    CHECK(!sg.isIntersectionAtPosition(Point(0,100)));
+
+    /* Equal positions across the border of a cell of the index. */
+    double shift = libcity::COORDINATES_EPSILON / 2;
+    CHECK(sg.isIntersectionAtPosition(Point(-shift, shift)));
+    CHECK(sg.getIntersectionAtPosition(Point(100 + shift, -shift)) ==
+          sg.getIntersectionAtPosition(Point(100,0)));
+    CHECK(sg.getIntersectionAtPosition(Point(0, 2*libcity::COORDINATES_EPSILON)) == 0);
+  }
+
+  TEST(IntersectionAtPositionAfterSplit)
+  {
+    StreetGraph sg;
+
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(100,0))));
+    sg.addRoad(Path(LineSegment(Point(50,-50), Point(50,50))));
+
+    CHECK_EQUAL(4, sg.numberOfRoads());
+    CHECK(sg.isIntersectionAtPosition(Point(50,0)));
+    CHECK_EQUAL(4, sg.getIntersectionAtPosition(Point(50,0))->numberOfWays());
+  }
+
+  TEST(IntersectionAtPositionAfterRemove)
+  {
+    StreetGraph sg;
+
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(100,0))));
+    sg.addRoad(Path(LineSegment(Point(100,0), Point(100,100))));
+
+    Intersection* corner = sg.getIntersectionAtPosition(Point(100,100));
+    sg.removeRoad(corner->getRoads().front());
+
+    CHECK(!sg.isIntersectionAtPosition(Point(100,100)));
+    CHECK(sg.isIntersectionAtPosition(Point(100,0)));
+    CHECK(sg.isIntersectionAtPosition(Point(0,0)));
+  }
+
+  TEST(RoadsInArea)
+  {
+    StreetGraph sg;
+
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(100,0))));
+    sg.addRoad(Path(LineSegment(Point(0,5000), Point(100,5000))));
+
+    std::vector<Road*> found = sg.getRoadsInArea(BoundingBox(Point(-10,-10), Point(10,10)));
+    CHECK_EQUAL(1u, found.size());
+    CHECK(found[0]->path()->begining() == Point(0,0));
+
+    found = sg.getRoadsInArea(BoundingBox(Point(50,-10), Point(60,6000)));
+    CHECK_EQUAL(2u, found.size());
+
+    found = sg.getRoadsInArea(BoundingBox(Point(200,200), Point(300,300)));
+    CHECK(found.empty());
+  }
+
+  TEST(RoadsInAreaDiagonal)
+  {
+    StreetGraph sg;
+
+    /* Long diagonal road, its bounding box covers the whole area. */
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(20000,20000))));
+
+    std::vector<Road*> found = sg.getRoadsInArea(BoundingBox(Point(12340,12340), Point(12350,12350)));
+    CHECK_EQUAL(1u, found.size());
+
+    found = sg.getRoadsInArea(BoundingBox(Point(15000,2000), Point(16000,3000)));
+    CHECK(found.empty());
+
+    /* The road is found right at a cell corner. */
+    found = sg.getRoadsInArea(BoundingBox(Point(4000,4000), Point(4000,4000)));
+    CHECK_EQUAL(1u, found.size());
+  }
+
+  TEST(RoadsInAreaAfterSplit)
+  {
+    StreetGraph sg;
+
+    /* Long road spanning many cells of the index. */
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(10000,0))));
+    sg.addRoad(Path(LineSegment(Point(9000,-50), Point(9000,50))));
+
+    CHECK_EQUAL(4, sg.numberOfRoads());
+
+    /* The shortened road must not be found far from its new end. */
+    std::vector<Road*> found = sg.getRoadsInArea(BoundingBox(Point(9500,-10), Point(9600,10)));
+    CHECK_EQUAL(1u, found.size());
+    CHECK(found[0]->path()->begining() == Point(9000,0));
+
+    /* Roads keep the order in which they were added. */
+    found = sg.getRoadsInArea(BoundingBox(Point(8000,-100), Point(9800,100)));
+    CHECK_EQUAL(4u, found.size());
+    CHECK(found[0]->path()->end() == Point(9000,0));
+
+    /* Crossing the shortened road splits it again. */
+    sg.addRoad(Path(LineSegment(Point(500,-50), Point(500,50))));
+    CHECK_EQUAL(7, sg.numberOfRoads());
+    CHECK_EQUAL(4, sg.getIntersectionAtPosition(Point(500,0))->numberOfWays());
+  }
+
+  TEST(RoadsInAreaAfterRemove)
+  {
+    StreetGraph sg;
+
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(100,0))));
+    sg.addRoad(Path(LineSegment(Point(100,0), Point(100,100))));
+
+    Intersection* corner = sg.getIntersectionAtPosition(Point(100,100));
+    sg.removeRoad(corner->getRoads().front());
+
+    std::vector<Road*> found = sg.getRoadsInArea(BoundingBox(Point(90,50), Point(110,150)));
+    CHECK(found.empty());
+  }
+
+  TEST(AddRoadsGrid)
+  {
+    std::vector<Path> paths;
+    for (int i = 0; i < 5; i++)
+    {
+      paths.push_back(Path(LineSegment(Point(-50, i*100), Point(450, i*100))));
+      paths.push_back(Path(LineSegment(Point(i*100, -50), Point(i*100, 450))));
+    }
+
+    StreetGraph batch;
+    batch.addRoads(paths);
+
+    StreetGraph sequential;
+    for (std::vector<Path>::iterator path = paths.begin();
+         path != paths.end();
+         path++)
+    {
+      sequential.addRoad(*path);
+    }
+
+    CHECK_EQUAL(sequential.numberOfRoads(), batch.numberOfRoads());
+    CHECK_EQUAL(sequential.getIntersections().size(), batch.getIntersections().size());
+    CHECK_EQUAL(4, batch.getIntersectionAtPosition(Point(200,200))->numberOfWays());
+    CHECK_EQUAL(1, batch.getIntersectionAtPosition(Point(-50,400))->numberOfWays());
+
+    StreetGraph::Intersections expected = sequential.getIntersections();
+    for (StreetGraph::Intersections::iterator intersection = expected.begin();
+         intersection != expected.end();
+         intersection++)
+    {
+      Intersection* found = batch.getIntersectionAtPosition((*intersection)->position());
+      CHECK(found != 0);
+      if (found != 0)
+      {
+        CHECK_EQUAL((*intersection)->numberOfWays(), found->numberOfWays());
+      }
+    }
+  }
+
+  TEST(AddRoadsIntoExisting)
+  {
+    StreetGraph sg;
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(1000,0))));
+
+    std::vector<Path> paths;
+    /* Crossing the existing road. */
+    paths.push_back(Path(LineSegment(Point(500,-100), Point(500,100))));
+    /* Ending on the existing road. */
+    paths.push_back(Path(LineSegment(Point(200,100), Point(200,0))));
+    /* Identical to some part of the new roads. */
+    paths.push_back(Path(LineSegment(Point(500,-100), Point(500,100))));
+
+    sg.addRoads(paths, Road::SECONDARY_ROAD);
+
+    CHECK_EQUAL(6, sg.numberOfRoads());
+    CHECK_EQUAL(4, sg.getIntersectionAtPosition(Point(500,0))->numberOfWays());
+    CHECK_EQUAL(3, sg.getIntersectionAtPosition(Point(200,0))->numberOfWays());
+
+    Intersection* top = sg.getIntersectionAtPosition(Point(500,100));
+    CHECK_EQUAL(Road::SECONDARY_ROAD, top->getRoads().front()->type());
+  }
+
+  TEST(AddRoadsCollinear)
+  {
+    StreetGraph sg;
+    sg.addRoad(Path(LineSegment(Point(0,500), Point(1000,500))));
+
+    std::vector<Path> paths;
+    paths.push_back(Path(LineSegment(Point(0,0), Point(600,0))));
+    /* Overlapping the first path along the same line. */
+    paths.push_back(Path(LineSegment(Point(400,0), Point(1000,0))));
+    /* Contained in the existing road. */
+    paths.push_back(Path(LineSegment(Point(200,500), Point(300,500))));
+    /* Crossing both overlapping paths. */
+    paths.push_back(Path(LineSegment(Point(500,-100), Point(500,100))));
+
+    sg.addRoads(paths);
+
+    CHECK_EQUAL(5, sg.numberOfRoads());
+    CHECK(!sg.isIntersectionAtPosition(Point(1000,0)));
+    CHECK(!sg.isIntersectionAtPosition(Point(200,500)));
+    CHECK_EQUAL(4, sg.getIntersectionAtPosition(Point(500,0))->numberOfWays());
+    CHECK_EQUAL(1, sg.getIntersectionAtPosition(Point(600,0))->numberOfWays());
+  }
+}
@@ -0,0 +1,75 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testTriangulator.cpp
+ * @date 17.10.2026
+ * @author libcity contributors
+ *
+ * @brief Unit test of the Triangulator class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+// Tested modules
+#include "../src/geometry/triangulator.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+
+SUITE(Triangulator)
+{
+  TEST(Square)
+  {
+    Polygon p(Point(0,0), Point(10,0), Point(10,10), Point(0,10));
+    Triangulator triangulator;
+    std::vector<int> indexes;
+
+    CHECK(triangulator.triangulate(p, &indexes));
+    CHECK_EQUAL(6u, indexes.size());
+  }
+
+  TEST(Concave)
+  {
+    Polygon p;
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(10,0));
+    p.addVertex(Point(10,10));
+    p.addVertex(Point(5,2));
+    p.addVertex(Point(0,10));
+
+    Triangulator triangulator;
+    std::vector<int> indexes;
+    CHECK(triangulator.triangulate(p, &indexes));
+    CHECK_EQUAL(9u, indexes.size());
+
+    /* Triangles cover the polygon exactly. */
+    double area = 0;
+    for (unsigned int i = 0; i < indexes.size(); i += 3)
+    {
+      area += Polygon(p.vertex(indexes[i]), p.vertex(indexes[i+1]), p.vertex(indexes[i+2])).area();
+    }
+    CHECK_CLOSE(p.area(), area, 1e-9);
+  }
+
+  TEST(ReuseAndClockwise)
+  {
+    Polygon clockwise(Point(0,0), Point(0,10), Point(10,10), Point(10,0));
+    Polygon bowTie(Point(0,0), Point(10,10), Point(10,0), Point(0,10));
+    Triangulator triangulator;
+    std::vector<int> indexes;
+
+    CHECK(!triangulator.triangulate(bowTie, &indexes));
+
+    CHECK(triangulator.triangulate(clockwise, &indexes));
+    CHECK_EQUAL(6u, indexes.size());
+  }
+}